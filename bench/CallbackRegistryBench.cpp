@@ -0,0 +1,105 @@
+#include "MicroBench.hpp"
+
+#include <CS2Kit/Core/CallbackRegistry.hpp>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+using CS2Kit::Core::CallbackRegistry;
+
+namespace
+{
+
+// The pre-slot-map registry, kept verbatim as the baseline: node-based map, monotonic ids,
+// and callers snapshotting handles before a dispatch that may mutate it.
+template <class T>
+class LegacyRegistry
+{
+public:
+    uint64_t Add(T item)
+    {
+        uint64_t id = _nextId++;
+        _items.emplace(id, std::move(item));
+        return id;
+    }
+    bool Remove(uint64_t id) { return _items.erase(id) > 0; }
+    T* Find(uint64_t id)
+    {
+        auto it = _items.find(id);
+        return it != _items.end() ? &it->second : nullptr;
+    }
+    const std::unordered_map<uint64_t, T>& Items() const { return _items; }
+
+private:
+    std::unordered_map<uint64_t, T> _items;
+    uint64_t _nextId = 1;
+};
+
+using Callback = std::function<void(int)>;
+constexpr int Listeners = 256;
+int g_sink = 0;
+
+template <class Registry>
+std::vector<uint64_t> Fill(Registry& reg)
+{
+    std::vector<uint64_t> ids;
+    for (int i = 0; i < Listeners; ++i)
+        ids.push_back(reg.Add([i](int slot) { g_sink += slot ^ i; }));
+    return ids;
+}
+
+}  // namespace
+
+BENCH_CASE("CallbackRegistry: dispatch 256 listeners")
+{
+    LegacyRegistry<Callback> legacy;
+    Fill(legacy);
+    MicroBench::Measure("unordered_map (live iteration)", Listeners, [&] {
+        for (const auto& [id, cb] : legacy.Items())
+            cb(3);
+    });
+
+    std::vector<uint64_t> snapshot;
+    MicroBench::Measure("unordered_map (snapshot + Find)", Listeners, [&] {
+        snapshot.clear();
+        for (const auto& [id, cb] : legacy.Items())
+            snapshot.push_back(id);
+        for (uint64_t id : snapshot)
+            if (auto* cb = legacy.Find(id))
+                (*cb)(3);
+    });
+
+    CallbackRegistry<Callback> slotMap;
+    Fill(slotMap);
+    MicroBench::Measure("slot map ForEach", Listeners, [&] { slotMap.ForEach([](Callback& cb) { cb(3); }); });
+    MicroBench::DoNotOptimize(g_sink);
+}
+
+BENCH_CASE("CallbackRegistry: Find by handle")
+{
+    LegacyRegistry<Callback> legacy;
+    auto legacyIds = Fill(legacy);
+    MicroBench::Measure("unordered_map", Listeners, [&] {
+        for (uint64_t id : legacyIds)
+            MicroBench::DoNotOptimize(legacy.Find(id));
+    });
+
+    CallbackRegistry<Callback> slotMap;
+    auto ids = Fill(slotMap);
+    MicroBench::Measure("slot map", Listeners, [&] {
+        for (uint64_t id : ids)
+            MicroBench::DoNotOptimize(slotMap.Find(id));
+    });
+}
+
+BENCH_CASE("CallbackRegistry: Add + Remove churn")
+{
+    LegacyRegistry<Callback> legacy;
+    Fill(legacy);
+    MicroBench::Measure("unordered_map", 1, [&] { legacy.Remove(legacy.Add([](int) {})); });
+
+    CallbackRegistry<Callback> slotMap;
+    Fill(slotMap);
+    MicroBench::Measure("slot map", 1, [&] { slotMap.Remove(slotMap.Add([](int) {})); });
+}
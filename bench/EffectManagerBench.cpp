@@ -0,0 +1,91 @@
+#include "MicroBench.hpp"
+
+#include <CS2Kit/Core/EffectManager.hpp>
+#include <CS2Kit/Core/Scheduler.hpp>
+#include <chrono>
+#include <span>
+#include <thread>
+
+using CS2Kit::Core::EffectManager;
+using CS2Kit::Core::Scheduler;
+
+namespace
+{
+
+constexpr int Slots = 64;
+constexpr int Kinds = 24;  // a fun-commands plugin's worth of effect kinds
+int g_stops = 0;
+
+// Every slot carries every kind; odd kinds are round-scoped, every fourth survives death.
+void ApplyAll(EffectManager& mgr)
+{
+    for (int slot = 0; slot < Slots; ++slot)
+        for (int kind = 0; kind < Kinds; ++kind)
+            mgr.Apply(slot, kind,
+                      {.RoundScoped = kind % 2 == 1, .SurvivesDeath = kind % 4 == 0, .OnStop = [] { ++g_stops; }});
+}
+
+}  // namespace
+
+BENCH_CASE("EffectManager: 64 slots x 24 kinds")
+{
+    Scheduler scheduler;
+    EffectManager mgr(scheduler);
+    ApplyAll(mgr);
+
+    MicroBench::Measure("IsActive", Slots * Kinds, [&] {
+        for (int slot = 0; slot < Slots; ++slot)
+            for (int kind = 0; kind < Kinds; ++kind)
+                MicroBench::DoNotOptimize(mgr.IsActive(slot, kind));
+    });
+
+    mgr.CancelRoundScoped();
+    MicroBench::Measure("CancelRoundScoped, nothing to cancel", 1, [&] { mgr.CancelRoundScoped(); });
+
+    // The round_start case: apply the round's effects, then sweep them (768 onStops).
+    MicroBench::Measure("ApplyAll", 1, [&] { ApplyAll(mgr); });
+    MicroBench::Measure("ApplyAll + CancelRoundScoped", 1, [&] {
+        ApplyAll(mgr);
+        mgr.CancelRoundScoped();
+    });
+    MicroBench::DoNotOptimize(g_stops);
+}
+
+// Times only the frames on which the 1 ms tick is due, waiting out the rest untimed.
+template <class Setup>
+void MeasureDueFrames(const char* variant, Setup setup)
+{
+    using Clock = std::chrono::steady_clock;
+    constexpr int Frames = 300;
+
+    Scheduler scheduler;
+    EffectManager mgr(scheduler);
+    setup(mgr);
+
+    Clock::duration timed{};
+    for (int i = 0; i < Frames; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(1100));
+        const auto start = Clock::now();
+        scheduler.OnGameFrame();
+        timed += Clock::now() - start;
+    }
+    MicroBench::Report(variant, std::chrono::duration<double, std::nano>(timed).count() / Frames, Frames);
+}
+
+BENCH_CASE("EffectManager: burn @all tick, 64 slots")
+{
+    int burned = 0;
+    MeasureDueFrames("64 OnTick timers", [&](EffectManager& mgr) {
+        for (int slot = 0; slot < Slots; ++slot)
+            mgr.Apply(slot, 0, {.TickIntervalMs = 1, .OnTick = [&burned, slot] { burned += slot; }, .OnStop = [] {}});
+    });
+    MeasureDueFrames("one OnTickBatch group", [&](EffectManager& mgr) {
+        for (int slot = 0; slot < Slots; ++slot)
+            mgr.Apply(slot, 0, {.TickIntervalMs = 1, .OnStop = [] {}, .OnTickBatch = [&burned](std::span<const int> slots) {
+                                    for (int slot : slots)
+                                        burned += slot;
+                                }});
+    });
+    MicroBench::DoNotOptimize(burned);
+}
@@ -0,0 +1,132 @@
+#include "MicroBench.hpp"
+
+#include <CS2Kit/Sdk/EntityRange.hpp>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using CS2Kit::Sdk::EntityRange;
+using CS2Kit::Sdk::IdentityLayout;
+
+namespace
+{
+
+// Stand-in CEntityIdentity, padded to the SDK's 0x70 bytes so the walk touches as many cache
+// lines as the real chunk table does.
+struct FakeIdentity
+{
+    CEntityInstance* Instance = nullptr;
+    std::byte _pad0[0x08];
+    uint32_t Handle = 0xFFFFFFFFu;
+    std::byte _pad1[0x0C];
+    const char* Name = nullptr;  // interned: one pointer per class
+    std::byte _pad2[0x30];
+    FakeIdentity* Next = nullptr;  // active list, the engine finder's walk order
+    std::byte _pad3[0x10];
+};
+static_assert(sizeof(FakeIdentity) == 0x70);
+
+constexpr int ChunkSize = 512;   // MAX_ENTITIES_IN_LIST
+constexpr int ChunkCount = 64;   // MAX_ENTITY_LISTS
+
+// A 4,000-entity map: ~60 classes of skewed popularity, 1 in 8 indices left free, and
+// 40 func_door entities scattered through it.
+struct FakeMap
+{
+    explicit FakeMap(int entities)
+    {
+        for (int c = 0; c < 60; ++c)
+            Names.push_back("class_" + std::to_string(c));
+        Names.push_back("func_door");
+
+        std::mt19937 rng(42);
+        FakeIdentity* tail = nullptr;
+        int placed = 0;
+        int doors = 0;
+        for (int index = 1; placed < entities; ++index)
+        {
+            if (rng() % 8 == 0)
+                continue;  // freed slot
+            auto& chunk = Storage[index / ChunkSize];
+            if (!chunk)
+            {
+                chunk = std::make_unique<FakeIdentity[]>(ChunkSize);
+                Chunks[index / ChunkSize] = chunk.get();
+            }
+            auto& identity = chunk[index % ChunkSize];
+            bool door = doors < 40 && placed % (entities / 40) == 7;
+            doors += door;
+            identity.Instance = reinterpret_cast<CEntityInstance*>(&identity);
+            identity.Handle = static_cast<uint32_t>(index) | (1u << 15);
+            identity.Name = door ? Names.back().c_str() : Names[(rng() % 60) * (rng() % 60) / 60].c_str();
+            if (tail)
+                tail->Next = &identity;
+            else
+                First = &identity;
+            tail = &identity;
+            ++placed;
+        }
+    }
+
+    // What CGameEntitySystem::FindEntityByClassName does: continue the active list after
+    // `startAfter`, string-comparing each designer name.
+    FakeIdentity* FindByClassName(FakeIdentity* startAfter, const char* name) const
+    {
+        for (auto* it = startAfter ? startAfter->Next : First; it; it = it->Next)
+            if (std::strcmp(it->Name, name) == 0)
+                return it;
+        return nullptr;
+    }
+
+    EntityRange Iterate(const char* name = nullptr) const
+    {
+        constexpr IdentityLayout layout{
+            .Stride = sizeof(FakeIdentity),
+            .InstanceOffset = offsetof(FakeIdentity, Instance),
+            .HandleOffset = offsetof(FakeIdentity, Handle),
+            .NameOffset = offsetof(FakeIdentity, Name),
+        };
+        return EntityRange(Chunks, ChunkCount, ChunkSize, layout, name);
+    }
+
+    std::vector<std::string> Names;
+    std::unique_ptr<FakeIdentity[]> Storage[ChunkCount];
+    void* Chunks[ChunkCount]{};
+    FakeIdentity* First = nullptr;
+};
+
+}  // namespace
+
+BENCH_CASE("EntitySystem: find every func_door on a 4,000-entity map")
+{
+    FakeMap map(4000);
+    const std::string query = "func_door";  // not the interned pointer, as with a plugin's literal
+
+    MicroBench::Measure("FindByClassName loop (strcmp walk)", 1, [&] {
+        int found = 0;
+        for (auto* it = map.FindByClassName(nullptr, query.c_str()); it; it = map.FindByClassName(it, query.c_str()))
+            ++found;
+        MicroBench::DoNotOptimize(found);
+    });
+    MicroBench::Measure("Iterate(name), chunk walk", 1, [&] {
+        int found = 0;
+        for (auto* entity : map.Iterate(query.c_str()))
+        {
+            MicroBench::DoNotOptimize(entity);
+            ++found;
+        }
+        MicroBench::DoNotOptimize(found);
+    });
+    MicroBench::Measure("Iterate(), every entity", 1, [&] {
+        int found = 0;
+        for (auto* entity : map.Iterate())
+        {
+            MicroBench::DoNotOptimize(entity);
+            ++found;
+        }
+        MicroBench::DoNotOptimize(found);
+    });
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+// cs2kit-bench stand-in for include/CS2Kit/Core/Services.hpp. bench/Fake precedes include/ on
+// the bench include path, so benchmarked kit TUs compile unchanged against this: same class,
+// same member names, but only the services those TUs reach and none that need the HL2SDK.
+// EntitySystem / SchemaService are backed by the synthetic world in FakeEngine.hpp.
+
+#include <CS2Kit/Core/Profiler.hpp>
+#include <CS2Kit/Core/Scheduler.hpp>
+#include <CS2Kit/Sdk/Entity.hpp>
+#include <CS2Kit/Sdk/GameData.hpp>
+#include <CS2Kit/Sdk/PlayerSnapshot.hpp>
+#include <CS2Kit/Sdk/TransmitFilter.hpp>
+#include <CS2Kit/Utils/Translations.hpp>
+#include <memory>
+
+namespace CS2Kit::Sdk
+{
+class SchemaService;
+}
+
+namespace CS2Kit::Core
+{
+
+class Services
+{
+public:
+    Services();
+    ~Services();
+    Services(const Services&) = delete;
+    Services& operator=(const Services&) = delete;
+
+    Core::Profiler Profiler;
+    Sdk::GameData GameData;
+    Sdk::EntitySystem Entities;
+    Sdk::PlayerSnapshot Snapshot;
+    Sdk::TransmitFilterService Transmit;
+    Core::Scheduler Scheduler;
+    Utils::Translations Translations;
+
+    Sdk::SchemaService& Schema() { return *_schema; }
+
+private:
+    std::unique_ptr<Sdk::SchemaService> _schema;
+};
+
+void SetActiveServices(Services* services);
+Services& Engine();
+Services* EngineOrNull();
+
+}  // namespace CS2Kit::Core
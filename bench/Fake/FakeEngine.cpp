@@ -0,0 +1,242 @@
+#include "FakeEngine.hpp"
+
+#include "Sdk/Schema.hpp"
+
+#include <CS2Kit/Core/ActiveService.hpp>
+#include <CS2Kit/Sdk/MemoryAccess.hpp>
+#include <CS2Kit/Sdk/SchemaField.hpp>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iservernetworkable.h>
+#include <string>
+
+using CS2Kit::Sdk::MemberPtr;
+using CS2Kit::Sdk::WriteAt;
+
+namespace FakeEngine
+{
+
+namespace
+{
+
+World* g_world = nullptr;
+
+// EHandle layout: entity index in the low 15 bits, serial above.
+constexpr uint32_t IndexMask = 0x7FFF;
+constexpr uint32_t InvalidHandle = 0xFFFFFFFF;
+
+struct FieldOffset
+{
+    const char* Class;
+    const char* Field;
+    int Offset;
+};
+
+// The synthetic layout. Any field not listed resolves to -1, as an unknown schema field would.
+constexpr FieldOffset Layout[] = {
+    {"CBasePlayerController", "m_hPawn", 0x10},
+    {"CCSPlayerController", "m_hPlayerPawn", 0x14},
+    {"CBasePlayerPawn", "m_pWeaponServices", 0x20},
+    {"CBasePlayerPawn", "m_pObserverServices", 0x28},
+    {"CBaseCombatCharacter", "m_hMyWearables", 0x30},
+    {"CPlayer_WeaponServices", "m_hMyWeapons", 0x10},
+    {"CPlayer_ObserverServices", "m_hObserverTarget", 0x08},
+};
+
+int LayoutOffset(const char* className, const char* fieldName)
+{
+    for (const auto& f : Layout)
+        if (std::strcmp(f.Class, className) == 0 && std::strcmp(f.Field, fieldName) == 0)
+            return f.Offset;
+    return -1;
+}
+
+// Entity blobs carry their own index (the engine reaches it through the entity identity).
+constexpr int EntityIndexOffset = 0x00;
+
+// Where a blob keeps the elements of its one handle vector (CNetworkUtlVectorBase points
+// out of line; here "out of line" is the back half of the same blob).
+constexpr int HandleStorageOffset = 0x80;
+
+uint32_t HandleOf(int index)
+{
+    return static_cast<uint32_t>(index) | (1u << 15);
+}
+
+// GameData reads its offsets from a file; hand it one describing the fake CCheckTransmitInfo.
+void LoadGameData(CS2Kit::Sdk::GameData& gameData)
+{
+    const auto slot = std::to_string(offsetof(CCheckTransmitInfo, m_nPlayerSlot));
+    const auto path = std::filesystem::temp_directory_path() / "cs2kit-bench-gamedata.json";
+    std::ofstream(path) << R"({"offsets":{"CheckTransmitPlayerSlot":{"linux":)" << slot << R"(,"windows":)" << slot
+                        << "}}}";
+    gameData.Load(path.string());
+}
+
+}  // namespace
+
+World::World(int players, int weaponsPerPlayer) : _services(std::make_unique<CS2Kit::Core::Services>())
+{
+    g_world = this;
+    CS2Kit::Core::SetActiveServices(_services.get());
+    LoadGameData(_services->GameData);
+    _entities.emplace_back();  // index 0
+
+    for (int slot = 0; slot < players; ++slot)
+    {
+        FakePlayer player;
+        player.Controller = NewEntity();
+        player.Pawn = NewEntity();
+        for (int w = 0; w < weaponsPerPlayer; ++w)
+            player.Weapons.push_back(NewEntity());
+        for (int w = 0; w < 2; ++w)
+            player.Wearables.push_back(NewEntity());
+
+        void* controller = Entity(player.Controller);
+        void* pawn = Entity(player.Pawn);
+        WriteAt<uint32_t>(controller, LayoutOffset("CBasePlayerController", "m_hPawn"), HandleOf(player.Pawn));
+        WriteAt<uint32_t>(controller, LayoutOffset("CCSPlayerController", "m_hPlayerPawn"), HandleOf(player.Pawn));
+
+        void* weaponServices = NewObject();
+        SetHandles(weaponServices, LayoutOffset("CPlayer_WeaponServices", "m_hMyWeapons"), player.Weapons);
+        WriteAt<void*>(pawn, LayoutOffset("CBasePlayerPawn", "m_pWeaponServices"), weaponServices);
+
+        // Nobody spectates: every recipient takes the full hide path.
+        void* observerServices = NewObject();
+        WriteAt<uint32_t>(observerServices, LayoutOffset("CPlayer_ObserverServices", "m_hObserverTarget"),
+                          InvalidHandle);
+        WriteAt<void*>(pawn, LayoutOffset("CBasePlayerPawn", "m_pObserverServices"), observerServices);
+
+        SetHandles(pawn, LayoutOffset("CBaseCombatCharacter", "m_hMyWearables"), player.Wearables);
+        _players.push_back(std::move(player));
+    }
+
+    _services->Transmit.Initialize();
+}
+
+World::~World()
+{
+    CS2Kit::Core::SetActiveServices(nullptr);
+    g_world = nullptr;
+}
+
+int World::NewEntity()
+{
+    const auto index = static_cast<int32_t>(_entities.size());
+    _entities.push_back(std::make_unique<Blob>());
+    WriteAt<int32_t>(_entities.back()->Bytes, EntityIndexOffset, index);
+    return index;
+}
+
+void* World::NewObject()
+{
+    _objects.push_back(std::make_unique<Blob>());
+    return _objects.back()->Bytes;
+}
+
+void World::SetHandles(void* base, int offset, const std::vector<int>& indices)
+{
+    auto* elements = MemberPtr<uint32_t>(base, HandleStorageOffset);
+    for (size_t i = 0; i < indices.size(); ++i)
+        elements[i] = HandleOf(indices[i]);
+    WriteAt<int32_t>(base, offset, static_cast<int32_t>(indices.size()));
+    WriteAt<const uint32_t*>(base, offset + 8, elements);
+}
+
+void* World::Entity(int index) const
+{
+    if (index <= 0 || index >= static_cast<int>(_entities.size()))
+        return nullptr;
+    return _entities[index]->Bytes;
+}
+
+int World::IndexOf(const void* entity) const
+{
+    return *reinterpret_cast<const int32_t*>(static_cast<const std::byte*>(entity) + EntityIndexOffset);
+}
+
+void* World::Controller(int slot) const
+{
+    if (slot < 0 || slot >= static_cast<int>(_players.size()))
+        return nullptr;
+    return Entity(_players[slot].Controller);
+}
+
+}  // namespace FakeEngine
+
+namespace CS2Kit::Core
+{
+
+Services::Services() : _schema(std::make_unique<Sdk::SchemaService>()) {}
+
+Services::~Services() = default;
+
+void SetActiveServices(Services* services)
+{
+    ActiveService<Services>::Set(services);
+}
+
+Services& Engine()
+{
+    return ActiveService<Services>::Get();
+}
+
+Services* EngineOrNull()
+{
+    return ActiveService<Services>::GetOrNull();
+}
+
+}  // namespace CS2Kit::Core
+
+namespace CS2Kit::Sdk
+{
+
+bool SchemaService::Initialize()
+{
+    return true;
+}
+
+int SchemaService::GetOffset(const char* className, const char* fieldName, int /*expectedSize*/)
+{
+    return FakeEngine::LayoutOffset(className, fieldName);
+}
+
+int ResolveSchemaOffset(const char* className, const char* fieldName, int expectedSize)
+{
+    return Core::Engine().Schema().GetOffset(className, fieldName, expectedSize);
+}
+
+// No engine listener to attach here; the bench never fires entity notifications.
+class EntitySystem::Listener
+{
+};
+
+EntitySystem::EntitySystem() = default;
+EntitySystem::~EntitySystem() = default;
+
+CEntityInstance* EntitySystem::GetPlayerController(int slot)
+{
+    return static_cast<CEntityInstance*>(FakeEngine::g_world->Controller(slot));
+}
+
+CEntityInstance* EntitySystem::ResolveEntityHandle(uint32_t handle)
+{
+    if (handle == FakeEngine::InvalidHandle)
+        return nullptr;
+    return static_cast<CEntityInstance*>(FakeEngine::g_world->Entity(static_cast<int>(handle & FakeEngine::IndexMask)));
+}
+
+int EntitySystem::GetEntityIndex(CEntityInstance* entity) const
+{
+    return entity ? FakeEngine::g_world->IndexOf(entity) : -1;
+}
+
+uint32_t EntitySystem::GetEntityHandle(CEntityInstance* entity) const
+{
+    const int index = GetEntityIndex(entity);
+    return index < 0 ? FakeEngine::InvalidHandle : FakeEngine::HandleOf(index);
+}
+
+}  // namespace CS2Kit::Sdk
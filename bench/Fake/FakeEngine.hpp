@@ -0,0 +1,64 @@
+#pragma once
+
+// Synthetic engine state for cs2kit-bench: owns the stand-in Services (Fake/CS2Kit/Core/
+// Services.hpp) and a heap of entity blobs laid out at the offsets the fake SchemaService
+// reports, so kit code that walks controllers -> pawns -> weapons by offset runs for real.
+
+#include <CS2Kit/Core/Services.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace FakeEngine
+{
+
+/** Entity indices and handle-vector sizes of one connected player. */
+struct FakePlayer
+{
+    int Controller = -1;
+    int Pawn = -1;
+    std::vector<int> Weapons;
+    std::vector<int> Wearables;
+};
+
+/**
+ * @brief A stand-in server: @p players connected slots, each with a controller, a pawn,
+ * @p weaponsPerPlayer weapons and two wearables. Makes its Services the active `Engine()`
+ * for its lifetime; one World at a time.
+ */
+class World
+{
+public:
+    explicit World(int players, int weaponsPerPlayer = 3);
+    ~World();
+    World(const World&) = delete;
+    World& operator=(const World&) = delete;
+
+    CS2Kit::Core::Services& Services() { return *_services; }
+    const std::vector<FakePlayer>& Players() const { return _players; }
+
+    /** Highest entity index in use + 1. */
+    int EntityCount() const { return static_cast<int>(_entities.size()); }
+
+    // Backing store for the fake EntitySystem (FakeEngine.cpp).
+    void* Entity(int index) const;
+    int IndexOf(const void* entity) const;
+    void* Controller(int slot) const;
+
+private:
+    struct alignas(16) Blob
+    {
+        std::byte Bytes[256]{};
+    };
+
+    int NewEntity();
+    void* NewObject();
+    void SetHandles(void* base, int offset, const std::vector<int>& indices);
+
+    std::unique_ptr<CS2Kit::Core::Services> _services;
+    std::vector<std::unique_ptr<Blob>> _entities;  // [entity index]; 0 is the world, left null
+    std::vector<std::unique_ptr<Blob>> _objects;   // non-entity components (weapon/observer services)
+    std::vector<FakePlayer> _players;
+};
+
+}  // namespace FakeEngine
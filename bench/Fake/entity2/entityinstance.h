@@ -0,0 +1,6 @@
+#pragma once
+
+// cs2kit-bench stand-in for the HL2SDK header: kit code only passes CEntityInstance* around
+// and reads fields by offset, so an opaque type is enough. Instances are FakeEngine blobs.
+
+class CEntityInstance;
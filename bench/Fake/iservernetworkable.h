@@ -0,0 +1,27 @@
+#pragma once
+
+// cs2kit-bench stand-in for the HL2SDK header: just the CheckTransmit surface the kit touches.
+
+#include <cstdint>
+#include <cstring>
+
+template <int BITS>
+class CBitVec
+{
+public:
+    void SetAll() { std::memset(_words, 0xFF, sizeof(_words)); }
+    void Set(int bit) { _words[bit >> 5] |= 1u << (bit & 31); }
+    void Clear(int bit) { _words[bit >> 5] &= ~(1u << (bit & 31)); }
+    bool IsBitSet(int bit) const { return (_words[bit >> 5] >> (bit & 31)) & 1u; }
+
+private:
+    uint32_t _words[(BITS + 31) / 32];
+};
+
+class CCheckTransmitInfo
+{
+public:
+    CBitVec<16384>* m_pTransmitEntity = nullptr;
+    CBitVec<16384>* m_pUnkBitVec = nullptr;
+    uint8_t m_nPlayerSlot = 0;  // read through the "CheckTransmitPlayerSlot" gamedata offset
+};
@@ -0,0 +1,45 @@
+#include "Fake/FakeEngine.hpp"
+#include "MicroBench.hpp"
+
+#include "Menu/MenuRenderer.hpp"
+
+#include <CS2Kit/Menu/MenuOption.hpp>
+#include <memory>
+#include <string>
+
+using namespace CS2Kit::Menu;
+
+namespace
+{
+
+class LabelOption final : public MenuOption
+{
+public:
+    explicit LabelOption(std::string label, bool horizontal = false)
+        : _label(std::move(label)), _horizontal(horizontal)
+    {
+    }
+    std::string GetLabel(int) const override { return _label; }
+    bool UsesHorizontal() const override { return _horizontal; }
+
+private:
+    std::string _label;
+    bool _horizontal;
+};
+
+}  // namespace
+
+BENCH_CASE("MenuRenderer: RenderMenuHtml")
+{
+    FakeEngine::World world(0);
+
+    MenuView menu;
+    menu.Title = "Punish player";
+    for (int i = 0; i < 12; ++i)
+        menu.Items.push_back(std::make_shared<LabelOption>("Option number " + std::to_string(i), i % 4 == 1));
+
+    MicroBench::Measure("12 items, first page", 1,
+                        [&] { MicroBench::DoNotOptimize(RenderMenuHtml(&menu, 3, 0, false)); });
+    MicroBench::Measure("12 items, last page, horizontal row", 1,
+                        [&] { MicroBench::DoNotOptimize(RenderMenuHtml(&menu, 3, 9, true)); });
+}
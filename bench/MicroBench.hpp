@@ -0,0 +1,181 @@
+#pragma once
+
+// Minimal self-contained benchmark harness, the timing counterpart of tests/MicroTest.hpp.
+// Each bench .cpp registers cases with BENCH_CASE; a case calls Measure() once per variant
+// it compares. MicroBenchMain.cpp runs every case and prints one line per measurement;
+// `--json <file>` also writes them as JSON for comparing runs across commits, and
+// `--filter <text>` runs only the cases whose name contains it.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace MicroBench
+{
+
+struct BenchCase
+{
+    std::string Name;
+    std::function<void()> Fn;
+};
+
+struct Measurement
+{
+    std::string Case;
+    std::string Variant;
+    double NsPerOp;
+    uint64_t Ops;
+};
+
+inline std::vector<BenchCase>& Registry()
+{
+    static std::vector<BenchCase> cases;
+    return cases;
+}
+
+inline std::vector<Measurement>& Results()
+{
+    static std::vector<Measurement> results;
+    return results;
+}
+
+inline std::string& CurrentCase()
+{
+    static std::string name;
+    return name;
+}
+
+struct Registrar
+{
+    Registrar(const char* name, std::function<void()> fn) { Registry().push_back({name, std::move(fn)}); }
+};
+
+/** Keep @p value observable so the optimizer cannot drop the work that produced it. */
+template <class T>
+inline void DoNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+/**
+ * @brief Time @p body, which performs @p opsPerRun operations per call. Runs it once to warm
+ * up, then repeatedly until at least @p minMs elapsed, and records the mean ns per operation.
+ */
+template <class Fn>
+void Measure(const char* variant, uint64_t opsPerRun, Fn&& body, int minMs = 100)
+{
+    using Clock = std::chrono::steady_clock;
+    body();
+
+    uint64_t runs = 0;
+    const auto start = Clock::now();
+    auto elapsed = Clock::duration::zero();
+    do
+    {
+        body();
+        ++runs;
+        elapsed = Clock::now() - start;
+    }
+    while (elapsed < std::chrono::milliseconds(minMs));
+
+    const double ns = std::chrono::duration<double, std::nano>(elapsed).count();
+    const uint64_t ops = runs * opsPerRun;
+    Results().push_back({CurrentCase(), variant, ns / static_cast<double>(ops), ops});
+}
+
+/** Record a measurement taken by hand, for cases whose timed region Measure cannot isolate. */
+inline void Report(const char* variant, double nsPerOp, uint64_t ops)
+{
+    Results().push_back({CurrentCase(), variant, nsPerOp, ops});
+}
+
+inline void WriteJsonString(std::FILE* out, std::string_view text)
+{
+    std::fputc('"', out);
+    for (char c : text)
+    {
+        if (c == '"' || c == '\\')
+            std::fputc('\\', out);
+        if (static_cast<unsigned char>(c) >= 0x20)
+            std::fputc(c, out);
+    }
+    std::fputc('"', out);
+}
+
+/** {"benchmarks":[{"case","variant","ns_per_op","ops"}...]} - one entry per Measure call. */
+inline bool WriteJson(const char* path)
+{
+    std::FILE* out = std::fopen(path, "w");
+    if (!out)
+        return false;
+    std::fputs("{\"benchmarks\":[", out);
+    for (size_t i = 0; i < Results().size(); ++i)
+    {
+        const auto& m = Results()[i];
+        std::fputs(i == 0 ? "\n  {\"case\":" : ",\n  {\"case\":", out);
+        WriteJsonString(out, m.Case);
+        std::fputs(",\"variant\":", out);
+        WriteJsonString(out, m.Variant);
+        std::fprintf(out, ",\"ns_per_op\":%.3f,\"ops\":%llu}", m.NsPerOp, static_cast<unsigned long long>(m.Ops));
+    }
+    std::fputs("\n]}\n", out);
+    return std::fclose(out) == 0;
+}
+
+inline int RunAllBenchmarks(int argc = 0, char** argv = nullptr)
+{
+    const char* jsonPath = nullptr;
+    const char* filter = nullptr;
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        if (std::strcmp(argv[i], "--json") == 0)
+            jsonPath = argv[i + 1];
+        else if (std::strcmp(argv[i], "--filter") == 0)
+            filter = argv[i + 1];
+        else
+        {
+            std::fprintf(stderr, "usage: %s [--json <file>] [--filter <text>]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    for (const auto& bc : Registry())
+    {
+        if (filter && bc.Name.find(filter) == std::string::npos)
+            continue;
+        CurrentCase() = bc.Name;
+        size_t first = Results().size();
+        bc.Fn();
+        std::printf("%s\n", bc.Name.c_str());
+        for (size_t i = first; i < Results().size(); ++i)
+            std::printf("  %-32s %12.2f ns/op  (%llu ops)\n", Results()[i].Variant.c_str(), Results()[i].NsPerOp,
+                        static_cast<unsigned long long>(Results()[i].Ops));
+    }
+
+    if (jsonPath && !WriteJson(jsonPath))
+    {
+        std::fprintf(stderr, "cannot write %s\n", jsonPath);
+        return 1;
+    }
+    return 0;
+}
+
+}  // namespace MicroBench
+
+#define MB_CONCAT_INNER(a, b) a##b
+#define MB_CONCAT(a, b)       MB_CONCAT_INNER(a, b)
+
+#define BENCH_CASE(name)                                                                              \
+    static void MB_CONCAT(mb_bench_, __LINE__)();                                                     \
+    static ::MicroBench::Registrar MB_CONCAT(mb_reg_, __LINE__)(name, &MB_CONCAT(mb_bench_, __LINE__)); \
+    static void MB_CONCAT(mb_bench_, __LINE__)()
@@ -0,0 +1,6 @@
+#include "MicroBench.hpp"
+
+int main(int argc, char** argv)
+{
+    return ::MicroBench::RunAllBenchmarks(argc, argv);
+}
@@ -0,0 +1,49 @@
+#include "MicroBench.hpp"
+
+#include <CS2Kit/Core/Scheduler.hpp>
+#include <string>
+
+using CS2Kit::Core::Scheduler;
+
+namespace
+{
+
+int g_fired = 0;
+
+}  // namespace
+
+BENCH_CASE("Scheduler: OnGameFrame, every timer due")
+{
+    for (int timers : {16, 256, 4096})
+    {
+        Scheduler sched;
+        for (int i = 0; i < timers; ++i)
+            sched.EveryFrame([] { ++g_fired; });
+        MicroBench::Measure((std::to_string(timers) + " EveryFrame").c_str(), 1, [&] { sched.OnGameFrame(); });
+    }
+    MicroBench::DoNotOptimize(g_fired);
+}
+
+BENCH_CASE("Scheduler: OnGameFrame, timers pending but not due")
+{
+    // The common steady state: many long-interval repeats, none firing this frame.
+    for (int timers : {16, 256, 4096})
+    {
+        Scheduler sched;
+        for (int i = 0; i < timers; ++i)
+            sched.Repeat(60'000 + i, [] { ++g_fired; });
+        MicroBench::Measure((std::to_string(timers) + " idle Repeat").c_str(), 1, [&] { sched.OnGameFrame(); });
+    }
+    MicroBench::DoNotOptimize(g_fired);
+}
+
+BENCH_CASE("Scheduler: NextTick register + fire")
+{
+    Scheduler sched;
+    MicroBench::Measure("64 NextTick per frame", 64, [&] {
+        for (int i = 0; i < 64; ++i)
+            sched.NextTick([] { ++g_fired; });
+        sched.OnGameFrame();
+    });
+    MicroBench::DoNotOptimize(g_fired);
+}
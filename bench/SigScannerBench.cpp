@@ -0,0 +1,117 @@
+#include "MicroBench.hpp"
+
+#include "Sdk/SigScanner.hpp"
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+using CS2Kit::Sdk::FindPatternInImage;
+using CS2Kit::Sdk::FindPatternsInImage;
+using CS2Kit::Sdk::ScanKernel;
+
+namespace
+{
+
+// A 32 MiB stand-in for libserver's text segment: random bytes with a sprinkling of x86
+// prologue bytes (0x48, 0x89, 0x55...), so the first pattern byte matches often and the
+// scanner pays for its inner loop, as it does on real code.
+std::vector<uint8_t> MakeImage(size_t size)
+{
+    std::vector<uint8_t> image(size);
+    std::mt19937 rng(1234);
+    const uint8_t common[] = {0x48, 0x89, 0x8B, 0x55, 0xE8, 0x00, 0xFF, 0x41};
+    for (auto& byte : image)
+    {
+        const uint32_t r = rng();
+        byte = (r & 3) == 0 ? common[(r >> 2) % sizeof(common)] : static_cast<uint8_t>(r >> 8);
+    }
+    return image;
+}
+
+void Plant(std::vector<uint8_t>& image, size_t at, std::initializer_list<uint8_t> bytes)
+{
+    for (uint8_t b : bytes)
+        image[at++] = b;
+}
+
+// @p count gamedata-like patterns: 12-20 bytes lifted from the image with every fourth-ish byte
+// wildcarded, so each one matches exactly where it was taken from.
+std::vector<std::string> TakePatterns(const std::vector<uint8_t>& image, size_t count)
+{
+    static constexpr char Digits[] = "0123456789ABCDEF";
+    std::mt19937 rng(4321);
+    std::vector<std::string> patterns;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const size_t length = 12 + rng() % 9;
+        const size_t at = rng() % (image.size() - length);
+        std::string pattern;
+        for (size_t j = 0; j < length; ++j)
+        {
+            if (!pattern.empty())
+                pattern += ' ';
+            if (j != 0 && rng() % 4 == 0)
+            {
+                pattern += '?';
+                continue;
+            }
+            pattern += Digits[image[at + j] >> 4];
+            pattern += Digits[image[at + j] & 0xF];
+        }
+        patterns.push_back(std::move(pattern));
+    }
+    return patterns;
+}
+
+}  // namespace
+
+BENCH_CASE("SigScanner: FindPattern over a 32 MiB image")
+{
+    constexpr size_t Size = size_t{32} << 20;
+    auto image = MakeImage(Size);
+    Plant(image, Size - 4096, {0x48, 0x89, 0x5C, 0x24, 0x08, 0x57, 0x48, 0x83, 0xEC, 0x20, 0x8B, 0xF9, 0xE8});
+
+    // Every scan walks the whole image: a unique match must still rule out a second one.
+    MicroBench::Measure("13-byte pattern, no wildcards", 1, [&] {
+        MicroBench::DoNotOptimize(FindPatternInImage(image.data(), image.size(),
+                                                     "48 89 5C 24 08 57 48 83 EC 20 8B F9 E8"));
+    }, 500);
+    MicroBench::Measure("13-byte pattern, wildcards", 1, [&] {
+        MicroBench::DoNotOptimize(FindPatternInImage(image.data(), image.size(),
+                                                     "48 89 5C 24 ? 57 48 83 EC ? 8B F9 E8"));
+    }, 500);
+    MicroBench::Measure("leading wildcard", 1, [&] {
+        MicroBench::DoNotOptimize(FindPatternInImage(image.data(), image.size(), "? 89 5C 24 08 57 48 83 EC 20"));
+    }, 500);
+
+    // The same scans pinned to each kernel: what Auto saves over trying every position.
+    MicroBench::Measure("13-byte pattern, wildcards, scalar kernel", 1, [&] {
+        MicroBench::DoNotOptimize(FindPatternInImage(image.data(), image.size(),
+                                                     "48 89 5C 24 ? 57 48 83 EC ? 8B F9 E8", ScanKernel::Scalar));
+    }, 500);
+    MicroBench::Measure("13-byte pattern, wildcards, SSE2 kernel", 1, [&] {
+        MicroBench::DoNotOptimize(FindPatternInImage(image.data(), image.size(),
+                                                     "48 89 5C 24 ? 57 48 83 EC ? 8B F9 E8", ScanKernel::Sse2));
+    }, 500);
+}
+
+BENCH_CASE("SigScanner: 30 gamedata patterns over a 40 MiB image")
+{
+    constexpr size_t Size = size_t{40} << 20;
+    const auto image = MakeImage(Size);
+    const auto patterns = TakePatterns(image, 30);
+
+    // GameData::ResolveAll before single-pass resolution: one full walk per signature.
+    MicroBench::Measure("one scan per pattern", 1, [&] {
+        for (const auto& pattern : patterns)
+            MicroBench::DoNotOptimize(FindPatternInImage(image.data(), image.size(), pattern));
+    }, 500);
+    MicroBench::Measure("one multi-pattern walk", 1, [&] {
+        MicroBench::DoNotOptimize(FindPatternsInImage(image.data(), image.size(), patterns));
+    }, 500);
+    MicroBench::Measure("one multi-pattern walk, scalar kernel", 1, [&] {
+        MicroBench::DoNotOptimize(FindPatternsInImage(image.data(), image.size(), patterns, ScanKernel::Scalar));
+    }, 500);
+}
@@ -0,0 +1,56 @@
+#include "MicroBench.hpp"
+
+#include <CS2Kit/Players/Targeting.hpp>
+#include <string>
+#include <vector>
+
+using namespace CS2Kit::Players;
+
+namespace
+{
+
+// A full server: alternating teams, a few bots and dead players, names with shared prefixes.
+std::vector<PlayerView> MakeRoster()
+{
+    std::vector<PlayerView> roster;
+    for (int slot = 0; slot < 64; ++slot)
+    {
+        roster.push_back({.Slot = slot,
+                          .SteamId = 76561197960265728LL + slot,
+                          .Name = (slot % 3 == 0 ? "Player_" : "sniper") + std::to_string(slot),
+                          .Team = 2 + slot % 2,
+                          .Alive = slot % 5 != 0,
+                          .Bot = slot % 16 == 15});
+    }
+    return roster;
+}
+
+}  // namespace
+
+BENCH_CASE("Targeting: ParseTargetToken")
+{
+    const char* tokens[] = {"@all", "@ct", "#12", "STEAM_1:0:12345", "[U:1:24690]", "76561197960290418", "Sniper4"};
+    for (const char* token : tokens)
+        MicroBench::Measure(token, 1, [&] { MicroBench::DoNotOptimize(ParseTargetToken(token)); });
+}
+
+BENCH_CASE("Targeting: FilterRoster over 64 players")
+{
+    const auto roster = MakeRoster();
+    const TargetRules multi{.AllowMultiple = true};
+    const TargetRules single{};
+
+    struct Variant
+    {
+        const char* Token;
+        const TargetRules* Rules;
+    };
+    const Variant variants[] = {{"@all", &multi}, {"@t", &multi}, {"@alive", &multi},
+                                {"#40", &single}, {"sniper62", &single}, {"iper6", &multi}};
+    for (const auto& v : variants)
+    {
+        const auto query = ParseTargetToken(v.Token);
+        MicroBench::Measure(v.Token, 1,
+                            [&] { MicroBench::DoNotOptimize(FilterRoster(roster, query, *v.Rules, /*callerSlot=*/0)); });
+    }
+}
@@ -0,0 +1,45 @@
+#include "MicroBench.hpp"
+
+#include <CS2Kit/Utils/Translations.hpp>
+#include <filesystem>
+#include <fstream>
+
+using CS2Kit::Utils::Tokens;
+using CS2Kit::Utils::Translations;
+
+namespace
+{
+
+// Two languages of a few hundred keys, the size of a real plugin's phrase files.
+std::filesystem::path WritePhrases()
+{
+    const auto dir = std::filesystem::temp_directory_path() / "cs2kit-bench-translations";
+    std::filesystem::create_directories(dir);
+    for (const char* lang : {"en", "de"})
+    {
+        std::ofstream file(dir / (std::string(lang) + ".json"));
+        file << "{\"punish\":{";
+        for (int i = 0; i < 300; ++i)
+            file << (i ? "," : "") << "\"key" << i << "\":\"[" << lang << "] {admin} punished {target} for {duration}\"";
+        file << "}}";
+    }
+    return dir;
+}
+
+}  // namespace
+
+BENCH_CASE("Translations: Get")
+{
+    Translations translations;
+    translations.Load(WritePhrases().string());
+    translations.SetPlayerLanguage(5, "de");
+
+    const std::string key = "punish.key150";
+    MicroBench::Measure("plain, server language", 1, [&] { MicroBench::DoNotOptimize(translations.Get(key)); });
+    MicroBench::Measure("plain, player language", 1, [&] { MicroBench::DoNotOptimize(translations.Get(key, 5)); });
+
+    const Tokens tokens{{"admin", "Console"}, {"target", "Player_12"}, {"duration", "30 minutes"}};
+    MicroBench::Measure("3 tokens, player language", 1,
+                        [&] { MicroBench::DoNotOptimize(translations.Get(key, 5, tokens)); });
+    MicroBench::Measure("missing key", 1, [&] { MicroBench::DoNotOptimize(translations.Get("punish.nope", 5)); });
+}
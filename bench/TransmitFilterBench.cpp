@@ -0,0 +1,58 @@
+#include "Fake/FakeEngine.hpp"
+#include "MicroBench.hpp"
+
+#include <iservernetworkable.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+// One CCheckTransmitInfo per connected client, the list the engine hands CheckTransmit.
+struct TransmitList
+{
+    explicit TransmitList(int clients) : Bits(clients), Infos(clients)
+    {
+        for (int i = 0; i < clients; ++i)
+        {
+            Bits[i].SetAll();
+            Infos[i].m_pTransmitEntity = &Bits[i];
+            Infos[i].m_nPlayerSlot = static_cast<uint8_t>(i);
+            Pointers.push_back(&Infos[i]);
+        }
+    }
+
+    std::vector<CBitVec<16384>> Bits;
+    std::vector<CCheckTransmitInfo> Infos;
+    std::vector<CCheckTransmitInfo*> Pointers;
+};
+
+}  // namespace
+
+BENCH_CASE("TransmitFilter: OnCheckTransmit, 64 recipients")
+{
+    constexpr int Clients = 64;
+    FakeEngine::World world(Clients);
+    auto& transmit = world.Services().Transmit;
+    TransmitList list(Clients);
+    world.Services().Snapshot.Capture();  // as the kit's OnGameFrame does before CheckTransmit
+
+    MicroBench::Measure("nothing hidden (early-out)", 1,
+                        [&] { transmit.OnCheckTransmit(list.Pointers.data(), Clients); });
+
+    for (int hidden : {1, 8, 32})
+    {
+        for (int slot = 0; slot < hidden; ++slot)
+            transmit.SetPawnHidden(slot, true);
+        MicroBench::Measure((std::to_string(hidden) + " pawns hidden").c_str(), 1,
+                            [&] { transmit.OnCheckTransmit(list.Pointers.data(), Clients); });
+    }
+
+    for (int slot = 0; slot < Clients; ++slot)
+        transmit.OnPlayerDisconnect(slot);
+    for (int i = 0; i < 32; ++i)
+        transmit.SetEntityExclusive(world.EntityCount() + i, i);
+    MicroBench::Measure("32 exclusive entities", 1,
+                        [&] { transmit.OnCheckTransmit(list.Pointers.data(), Clients); });
+}
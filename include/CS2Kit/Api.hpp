@@ -17,14 +17,18 @@
 #include <CS2Kit/Core/CallbackRegistry.hpp>
 #include <CS2Kit/Core/EffectDescriptor.hpp>
 #include <CS2Kit/Core/EffectManager.hpp>
+#include <CS2Kit/Core/InplaceFunction.hpp>
 #include <CS2Kit/Core/JsonConfig.hpp>
 #include <CS2Kit/Core/LoadReport.hpp>
 #include <CS2Kit/Core/MetamodPluginBase.hpp>
 #include <CS2Kit/Core/PluginBase.hpp>
 #include <CS2Kit/Core/PluginPolicy.hpp>
+#include <CS2Kit/Core/Profiler.hpp>
 #include <CS2Kit/Core/Registry.hpp>
 #include <CS2Kit/Core/Scheduler.hpp>
 #include <CS2Kit/Core/Services.hpp>
+#include <CS2Kit/Core/Task.hpp>
+#include <CS2Kit/Core/ThreadPool.hpp>
 // Database headers need libpqxx; only present when the kit was built with
 // CS2KIT_ENABLE_POSTGRES (the macro is a PUBLIC define of the cs2-kit target).
 #ifdef CS2KIT_ENABLE_POSTGRES
@@ -52,6 +56,8 @@
 #include <CS2Kit/Sdk/Entity.hpp>
 #include <CS2Kit/Sdk/EntityKeyValues.hpp>
 #include <CS2Kit/Sdk/EntityOps.hpp>
+#include <CS2Kit/Sdk/EntityPool.hpp>
+#include <CS2Kit/Sdk/EntitySpawnTemplate.hpp>
 #include <CS2Kit/Sdk/GameEventService.hpp>
 #include <CS2Kit/Sdk/GameEvents.hpp>
 #include <CS2Kit/Sdk/GlowVision.hpp>
@@ -60,9 +66,12 @@
 #include <CS2Kit/Sdk/MovementHook.hpp>
 #include <CS2Kit/Sdk/PawnOps.hpp>
 #include <CS2Kit/Sdk/PawnPredicates.hpp>
+#include <CS2Kit/Sdk/PawnView.hpp>
 #include <CS2Kit/Sdk/PersistentCenterHtml.hpp>
 #include <CS2Kit/Sdk/PlayerController.hpp>
+#include <CS2Kit/Sdk/PlayerSnapshot.hpp>
 #include <CS2Kit/Sdk/ServerCommand.hpp>
+#include <CS2Kit/Sdk/SpatialService.hpp>
 #include <CS2Kit/Sdk/UserCmd.hpp>
 #include <CS2Kit/Sdk/UserMessage.hpp>
 #include <CS2Kit/Utils/AngleMath.hpp>
@@ -87,6 +96,7 @@ using Core::EffectManager;
 using Core::EffectScope;
 using Core::EffectSpec;
 using Core::Engine;
+using Core::InplaceFunction;
 using Core::JsonConfig;
 using Core::LoadReport;
 using Core::MetamodPluginBase;
@@ -94,12 +104,16 @@ using Core::ParamEffectDescriptor;
 using Core::PluginBase;
 using Core::PluginInfo;
 using Core::PluginPolicy;
+using Core::Profiler;
 using Core::Registry;
 using Core::Scheduler;
 using Core::Services;
 using Core::StageResult;
 using Core::StageStatus;
 using Core::StatusService;
+using Core::Task;
+using Core::TaskHost;
+using Core::ThreadPool;
 using Core::ToggleEffect;
 
 // Sdk
@@ -107,6 +121,8 @@ using Sdk::ChatInputCapture;
 using Sdk::ConVarService;
 using Sdk::EntityKeyValues;
 using Sdk::EntityOpsService;
+using Sdk::EntityPool;
+using Sdk::EntitySpawnTemplate;
 using Sdk::EntitySystem;
 using Sdk::GameEventService;
 using Sdk::GlowVision;
@@ -117,12 +133,18 @@ using Sdk::MessageKind;
 using Sdk::MessageSystem;
 using Sdk::MovementHook;
 using Sdk::MoveType;
+using Sdk::PawnView;
 using Sdk::PersistentCenterHtml;
 using Sdk::PlayerController;
+using Sdk::PlayerSnapshot;
 using Sdk::RawConVar;
 using Sdk::ServerCommand;
+using Sdk::SpatialHit;
+using Sdk::SpatialIndex;
+using Sdk::SpatialService;
 using Sdk::SubtickMove;
 using Sdk::UserCmdView;
+using Sdk::Vec3;
 namespace PawnOps = Sdk::PawnOps;
 namespace Events = Sdk::Events;
 
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <concepts>
 #include <cstdint>
-#include <unordered_map>
+#include <optional>
+#include <utility>
+#include <vector>
 
 namespace CS2Kit::Core
 {
@@ -11,46 +14,249 @@ namespace CS2Kit::Core
  *
  * Scheduler timers, ConVar change listeners, and game-event listeners all need the same
  * thing: add an item, get back a stable `uint64_t` handle, remove by handle later. This
- * is that one implementation. Handles start at 1 and never repeat within a Load/Unload
- * cycle, so 0 is free to mean "no registration".
+ * is that one implementation: a generational slot map. Items live contiguously (dispatch
+ * walks one array), a sparse slot table maps handles to them, and Add/Remove/Find are O(1).
  *
- * Iteration order is unspecified (unordered_map). Callers that fire callbacks while
- * iterating should snapshot handles first if a callback may mutate the registry.
+ * A handle packs `(space << 56) | (generation << 24) | (slot + 1)`. Removing an item bumps
+ * its slot's generation, so a stale handle never resolves to a later occupant; a slot whose
+ * generation would wrap is retired instead of reused. Handles therefore never repeat within
+ * a Load/Unload cycle, and 0 is free to mean "no registration".
+ *
+ * Owners sharing one handle space across several registries (MovementHook's five listener
+ * kinds behind a single RemoveListener) give each registry a distinct @p space; a handle from
+ * one registry is then rejected by every other.
+ *
+ * @ref ForEach is safe against re-entrant mutation: a callback may Add or Remove (itself
+ * included) while the registry is being walked. Removed items are skipped and destroyed once
+ * the outermost walk ends; added items join after it and are not visited by it. Iteration
+ * order is unspecified.
  */
 template <class T>
 class CallbackRegistry
 {
 public:
-    /** Store @p item and return its handle. */
-    uint64_t Add(T item) { return Add(std::move(item), _nextId++); }
+    explicit CallbackRegistry(uint8_t space = 0) : _space(space) {}
 
-    /** Store @p item under a caller-supplied @p id - for owners sharing one handle space across several registries. */
-    uint64_t Add(T item, uint64_t id)
+    /** Store @p item and return its handle (0 only if all 2^24 slots are live or retired). */
+    uint64_t Add(T item)
     {
-        _items.emplace(id, std::move(item));
-        return id;
+        if (_free.empty() && _slots.size() >= MaxSlots)
+            return 0;
+        uint32_t slot = AcquireSlot();
+        if (_walking > 0)
+        {
+            // Appending to _items could reallocate under the item being invoked; park it instead.
+            _slots[slot].Pos = PendingBit | static_cast<uint32_t>(_pending.size());
+            _pending.push_back({slot, std::move(item)});
+        }
+        else
+        {
+            _slots[slot].Pos = static_cast<uint32_t>(_items.size());
+            _items.push_back({slot, std::move(item)});
+        }
+        ++_live;
+        return MakeHandle(slot);
     }
 
     /** Remove by handle. Safe to call with an unknown id; returns whether anything was removed. */
-    bool Remove(uint64_t id) { return _items.erase(id) > 0; }
+    bool Remove(uint64_t id)
+    {
+        auto slot = Resolve(id);
+        if (!slot)
+            return false;
+
+        uint32_t pos = _slots[*slot].Pos;
+        ReleaseSlot(*slot);
+        --_live;
+
+        if (pos & PendingBit)
+        {
+            _pending[pos & ~PendingBit].Slot = NoSlot;  // dropped at the end of the walk
+        }
+        else if (_walking > 0)
+        {
+            _items[pos].Slot = NoSlot;  // may be the item being invoked: keep it alive until the walk ends
+            ++_tombstones;
+        }
+        else
+        {
+            // Swap-and-pop: move the last item into the hole and repoint its slot.
+            if (pos + 1 != _items.size())
+            {
+                _items[pos] = std::move(_items.back());
+                _slots[_items[pos].Slot].Pos = pos;
+            }
+            _items.pop_back();
+        }
+        return true;
+    }
+
+    void Clear()
+    {
+        for (uint32_t slot = 0; slot < _slots.size(); ++slot)
+            if (_slots[slot].Pos != NoSlot)
+                ReleaseSlot(slot);
+        _live = 0;
+
+        if (_walking > 0)
+        {
+            for (auto& entry : _items)
+                if (entry.Slot != NoSlot)
+                {
+                    entry.Slot = NoSlot;
+                    ++_tombstones;
+                }
+            for (auto& entry : _pending)
+                entry.Slot = NoSlot;
+        }
+        else
+        {
+            _items.clear();
+        }
+    }
 
-    void Clear() { _items.clear(); }
+    bool Contains(uint64_t id) const { return Resolve(id).has_value(); }
 
-    bool Empty() const { return _items.empty(); }
+    bool Empty() const { return _live == 0; }
+    size_t Size() const { return _live; }
 
     /** The stored item, or nullptr if the handle is gone. Pointer invalidated by Add/Remove. */
     T* Find(uint64_t id)
     {
-        auto it = _items.find(id);
-        return it != _items.end() ? &it->second : nullptr;
+        auto slot = Resolve(id);
+        if (!slot)
+            return nullptr;
+        uint32_t pos = _slots[*slot].Pos;
+        return (pos & PendingBit) ? &_pending[pos & ~PendingBit].Item : &_items[pos].Item;
     }
 
-    /** Direct view for range-for; pairs of (handle, item). */
-    const std::unordered_map<uint64_t, T>& Items() const { return _items; }
+    /**
+     * @brief Invoke @p fn on every live item, as `fn(item)` or `fn(handle, item)`.
+     * Re-entrant Add/Remove/Clear from @p fn is safe; see the class docs for what the walk sees.
+     */
+    template <class Fn>
+    void ForEach(Fn&& fn)
+    {
+        WalkGuard guard(*this);
+        // Index, not iterator: the size is fixed for the walk (adds are parked), items never move.
+        const size_t count = _items.size();
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto& entry = _items[i];
+            if (entry.Slot == NoSlot)
+                continue;
+            if constexpr (std::invocable<Fn&, uint64_t, T&>)
+                fn(MakeHandle(entry.Slot), entry.Item);
+            else
+                fn(entry.Item);
+        }
+    }
 
 private:
-    std::unordered_map<uint64_t, T> _items;
-    uint64_t _nextId = 1;
+    struct Slot
+    {
+        uint32_t Generation = 0;
+        uint32_t Pos = NoSlot;  // index into _items, or PendingBit | index into _pending
+    };
+
+    struct Entry
+    {
+        uint32_t Slot;  // owning slot, or NoSlot once removed mid-walk
+        T Item;
+    };
+
+    /** Ends a walk; the outermost one compacts tombstones and merges parked adds. */
+    struct WalkGuard
+    {
+        CallbackRegistry& Reg;
+        explicit WalkGuard(CallbackRegistry& reg) : Reg(reg) { ++Reg._walking; }
+        ~WalkGuard()
+        {
+            if (--Reg._walking == 0)
+                Reg.Settle();
+        }
+    };
+
+    static constexpr uint32_t NoSlot = ~0u;
+    static constexpr uint32_t PendingBit = 1u << 31;
+    static constexpr int IndexBits = 24;
+    static constexpr uint32_t MaxSlots = (1u << IndexBits) - 1;  // slot + 1 must fit the index field
+
+    uint64_t MakeHandle(uint32_t slot) const
+    {
+        return (uint64_t{_space} << 56) | (uint64_t{_slots[slot].Generation} << IndexBits) | (slot + 1);
+    }
+
+    std::optional<uint32_t> Resolve(uint64_t id) const
+    {
+        uint64_t index = id & MaxSlots;
+        if (index == 0 || (id >> 56) != _space)
+            return std::nullopt;
+        uint32_t slot = static_cast<uint32_t>(index - 1);
+        if (slot >= _slots.size() || _slots[slot].Pos == NoSlot ||
+            _slots[slot].Generation != static_cast<uint32_t>(id >> IndexBits))
+            return std::nullopt;
+        return slot;
+    }
+
+    uint32_t AcquireSlot()
+    {
+        if (!_free.empty())
+        {
+            uint32_t slot = _free.back();
+            _free.pop_back();
+            return slot;
+        }
+        _slots.push_back({});
+        return static_cast<uint32_t>(_slots.size() - 1);
+    }
+
+    void ReleaseSlot(uint32_t slot)
+    {
+        auto& s = _slots[slot];
+        s.Pos = NoSlot;
+        // A wrapped generation would let an ancient handle match again: retire the slot instead.
+        if (++s.Generation != 0)
+            _free.push_back(slot);
+    }
+
+    void Settle()
+    {
+        if (_tombstones > 0)
+        {
+            // Stable compaction keeps surviving items in their relative order.
+            size_t kept = 0;
+            for (size_t i = 0; i < _items.size(); ++i)
+            {
+                if (_items[i].Slot == NoSlot)
+                    continue;
+                if (kept != i)
+                    _items[kept] = std::move(_items[i]);
+                _slots[_items[kept].Slot].Pos = static_cast<uint32_t>(kept);
+                ++kept;
+            }
+            _items.erase(_items.begin() + static_cast<std::ptrdiff_t>(kept), _items.end());
+            _tombstones = 0;
+        }
+
+        for (auto& entry : _pending)
+        {
+            if (entry.Slot == NoSlot)
+                continue;
+            _slots[entry.Slot].Pos = static_cast<uint32_t>(_items.size());
+            _items.push_back(std::move(entry));
+        }
+        _pending.clear();
+    }
+
+    std::vector<Slot> _slots;     // sparse: handle -> position
+    std::vector<Entry> _items;    // dense: what ForEach walks
+    std::vector<Entry> _pending;  // adds made during a walk
+    std::vector<uint32_t> _free;  // released slots awaiting reuse (at a bumped generation)
+    size_t _live = 0;
+    size_t _tombstones = 0;
+    int _walking = 0;
+    uint8_t _space;
 };
 
 }  // namespace CS2Kit::Core
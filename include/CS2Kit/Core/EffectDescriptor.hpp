@@ -1,7 +1,9 @@
 #pragma once
 
+#include <CS2Kit/Core/Scheduler.hpp>
 #include <CS2Kit/Players/ActionDispatcher.hpp>
 #include <functional>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -25,8 +27,8 @@ enum class EffectScope
  */
 struct EffectInstance
 {
-    std::function<void()> OnTick;
-    std::function<void()> OnStop;
+    Scheduler::Callback OnTick;
+    Scheduler::Callback OnStop;
 };
 
 /** One selectable option for a @ref ParamEffectDescriptor submenu. */
@@ -57,6 +59,8 @@ struct EffectDescriptor
     int DurationMs = 0;
     bool RequireAlive = false;
     std::function<EffectInstance(const Players::ActionContext&)> Setup;
+    /** Batched tick: one call per `TickIntervalMs` for every slot running this effect (see @ref EffectSpec). */
+    std::function<void(std::span<const int> slots)> OnTickBatch;
 };
 
 /** Like @ref EffectDescriptor but `Setup` receives a menu-supplied int (e.g. a model index). */
@@ -74,6 +78,8 @@ struct ParamEffectDescriptor
     bool RequireAlive = false;
     std::function<std::vector<EffectChoice>()> Choices;
     std::function<EffectInstance(const Players::ActionContext&, int param)> Setup;
+    /** Batched tick: one call per `TickIntervalMs` and param, with every slot running it at that param. */
+    std::function<void(std::span<const int> slots, int param)> OnTickBatch;
 };
 
 /** Apply if inactive, clear if active. Broadcasts OnKey/OffKey. The default menu-row verb. */
@@ -1,19 +1,32 @@
 #pragma once
 
 #include <CS2Kit/Core/ScheduledEffect.hpp>
+#include <algorithm>
 #include <array>
-#include <functional>
-#include <unordered_map>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
 
 namespace CS2Kit::Core
 {
 
+/** Batched tick body: every slot currently running the effect, in ascending order. */
+using BatchTickCallback = InplaceFunction<void(std::span<const int> slots)>;
+
 /**
  * @brief How to apply and tear down one player effect, expressed as data.
  *
  * The manager builds a @ref ScheduledEffect from this: `OnTick` runs every `TickIntervalMs`
  * (omit for state-only effects), `DurationMs > 0` auto-expires the effect, and `OnStop` runs
  * exactly once when it ends for any reason - so it is the single place to undo `OnTick`'s state.
+ *
+ * `OnTickBatch` replaces `OnTick` for effects applied to many players at once ("burn @all"):
+ * every slot running the same effect id at the same interval and `BatchKey` shares one timer,
+ * which calls the batch body once with all of their slots. The group ticks on its own phase (set
+ * by the first member) and runs the body of the Apply that created it, so Applies of one id and
+ * interval whose bodies differ must pass different keys (parameterized effects use the param).
+ * Expiry and `OnStop` stay per slot.
  */
 struct EffectSpec
 {
@@ -21,43 +34,61 @@ struct EffectSpec
     int DurationMs = 0;           /**< >0 => auto-expire after this long. */
     bool RoundScoped = false;     /**< Auto-cancel via @ref EffectManager::CancelRoundScoped. */
     bool SurvivesDeath = false;   /**< Skip the death sweep (@ref EffectManager::CancelPerLife). */
-    std::function<void()> OnTick; /**< Repeating body; null for state-only effects. */
-    std::function<void()> OnStop; /**< Undo/restore; runs exactly once on any end. */
-};
-
-/**
- * @brief Per-target effect bookkeeping. Each active effect owns one @ref ScheduledEffect, which
- * holds its tick timer, auto-expire timer, and the single onStop that undoes its state.
- */
-struct ActiveEffect
-{
-    bool RoundScoped = false;
-    bool SurvivesDeath = false;
-    ScheduledEffect Fx;
+    Scheduler::Callback OnTick;   /**< Repeating body; null for state-only effects. */
+    Scheduler::Callback OnStop;   /**< Undo/restore; runs exactly once on any end. */
+    BatchTickCallback OnTickBatch; /**< Shared repeating body; takes precedence over OnTick. */
+    int BatchKey = 0;              /**< Separates tick groups of one id and interval by body. */
 };
 
 /**
  * @brief Per-slot registry of toggleable/timed player effects, keyed by a plugin-defined
- * integer id (cast your effect enum). Owns each effect's @ref ScheduledEffect and its
- * re-apply/replace semantics.
+ * integer id (cast your effect enum; ids must be below @ref MaxEffectIds). Owns each effect's
+ * @ref ScheduledEffect and its re-apply/replace semantics.
+ *
+ * Storage is a flat slot x id table with one 64-bit mask per slot for "active", "round-scoped"
+ * and "survives death": @ref IsActive is a bit test, and the round/death sweeps visit only the
+ * set bits of `active & flag` - a round_start sweep over a full server is a few hundred
+ * instructions plus the onStops it has to run. Auto-expiry is scheduled by the manager itself,
+ * so a self-expired effect clears its bit the moment it stops.
+ *
+ * Effect state comes from a @ref ScheduledEffect::Pool owned by the manager and sized
+ * `MaxSlots x effectKinds` - every effect that can be active at once - so Apply and Cancel do
+ * not touch the heap once the scheduler's own storage has warmed up.
  *
  * Deliberately plugin-owned rather than a kit service: onStop closures touch pawns and
  * timers, so the owning plugin must control when CancelAll runs relative to engine teardown.
+ * The destructor cancels whatever is still active (running its onStop).
  */
 class EffectManager
 {
 public:
     static constexpr int MaxSlots = 64;
+    /** Effect ids are bit positions: one per plugin effect kind. */
+    static constexpr int MaxEffectIds = 64;
 
-    explicit EffectManager(Scheduler& scheduler) : _scheduler(scheduler) {}
+    /** @p effectKinds is how many distinct ids the plugin uses; it only sizes the state pool. */
+    explicit EffectManager(Scheduler& scheduler, int effectKinds = MaxEffectIds)
+        : _scheduler(scheduler),
+          _pool(static_cast<size_t>(MaxSlots) * static_cast<size_t>(std::clamp(effectKinds, 1, MaxEffectIds)))
+    {
+    }
+    ~EffectManager();
+    EffectManager(const EffectManager&) = delete;
+    EffectManager& operator=(const EffectManager&) = delete;
 
-    bool IsActive(int slot, int effectId) const;
+    bool IsActive(int slot, int effectId) const
+    {
+        return ValidSlot(slot) && ValidId(effectId) && (_active[slot] >> effectId & 1);
+    }
+
+    /** Bit `id` set for every effect active on @p slot (0 for an invalid slot). */
+    uint64_t ActiveMask(int slot) const { return ValidSlot(slot) ? _active[slot] : 0; }
 
     /**
      * @brief Register a new effect for `slot`. If an effect of the same id is already active,
      * it is cancelled first (re-apply/replace semantics). The effect self-expires after
-     * `spec.DurationMs` (if set), running `spec.OnStop`; the now-inactive slot entry is
-     * reclaimed lazily on the next Apply/Cancel for that id.
+     * `spec.DurationMs` (if set), running `spec.OnStop`. Ids outside [0, MaxEffectIds) are
+     * rejected with a warning.
      */
     void Apply(int slot, int effectId, EffectSpec spec);
 
@@ -71,13 +102,47 @@ public:
     void CancelAll();
 
 private:
-    // Snapshot the ids to cancel before cancelling: Cancel runs onStop, which may re-enter the
-    // slot map, so the map must not be iterated while entries are erased.
-    void CancelWhere(int slot, const std::function<bool(int id, const ActiveEffect&)>& keep);
+    struct Entry
+    {
+        ScheduledEffect Fx;
+        uint64_t ExpireTimer = 0;
+        int BatchIntervalMs = 0;  // >0 while a member of the (id, interval, key) tick group
+        int BatchKey = 0;
+    };
+
+    // One shared timer for every slot running effect `EffectId` at `IntervalMs` under `Key`.
+    struct TickGroup
+    {
+        int EffectId;
+        int IntervalMs;
+        int Key;
+        uint64_t Slots = 0;  // member bit per slot
+        uint64_t Timer = 0;
+        bool Running = false;  // inside Tick: membership may change, erasure waits until it returns
+        BatchTickCallback Tick;
+    };
+
+    static bool ValidSlot(int slot) { return slot >= 0 && slot < MaxSlots; }
+    static bool ValidId(int effectId) { return effectId >= 0 && effectId < MaxEffectIds; }
+
+    // Cancel each effect of @p slot whose bit is in @p mask. onStop may re-enter (apply or
+    // cancel other effects), so each bit is re-checked against the live mask before it is visited.
+    void CancelMask(int slot, uint64_t mask);
+    void Expire(int slot, int effectId);
+
+    TickGroup* FindGroup(int effectId, int intervalMs, int key) const;
+    void JoinGroup(int slot, int effectId, int intervalMs, int key, BatchTickCallback tick);
+    void LeaveGroup(int slot, int effectId, int intervalMs, int key);
+    void RunGroup(TickGroup* group);
+    void RemoveGroup(TickGroup* group);
 
     Scheduler& _scheduler;
-    // Slot-indexed array of small maps: only a handful of effects run per player at once.
-    std::array<std::unordered_map<int, ActiveEffect>, MaxSlots> _effects{};
+    ScheduledEffect::Pool _pool;  // declared before _entries: outlives every handle in it
+    std::array<std::array<Entry, MaxEffectIds>, MaxSlots> _entries{};
+    std::array<uint64_t, MaxSlots> _active{};
+    std::array<uint64_t, MaxSlots> _roundScoped{};
+    std::array<uint64_t, MaxSlots> _survivesDeath{};
+    std::vector<std::unique_ptr<TickGroup>> _groups;  // few: one per (batched effect id, interval, key) in use
 };
 
 }  // namespace CS2Kit::Core
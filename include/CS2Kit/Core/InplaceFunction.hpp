@@ -0,0 +1,144 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace CS2Kit::Core
+{
+
+/** Inline capture budget for the kit's hot-path callbacks: six pointers, or a std::function plus two. */
+inline constexpr size_t DefaultInplaceCapacity = 48;
+
+template <class Signature, size_t Capacity = DefaultInplaceCapacity>
+class InplaceFunction;
+
+/**
+ * @brief Move-only `std::function` replacement that stores small closures inline.
+ *
+ * A callable whose size fits @p Capacity (and that is nothrow-movable) lives inside the
+ * object, so constructing, moving, and invoking it never touches the heap. Larger callables
+ * still work - they fall back to one heap allocation, like `std::function` - so the capacity
+ * is a performance knob, never a compile error at a plugin's call site.
+ *
+ * Used for the callbacks the kit stores and fires every frame (scheduler timers, effect
+ * bodies, movement and game-event listeners). Being move-only, it accepts closures that
+ * capture `unique_ptr`s; converting from an empty `std::function` or null function pointer
+ * yields an empty InplaceFunction, so `if (fn)` keeps its meaning.
+ */
+template <class R, class... Args, size_t Capacity>
+class InplaceFunction<R(Args...), Capacity>
+{
+public:
+    InplaceFunction() noexcept = default;
+    InplaceFunction(std::nullptr_t) noexcept {}
+
+    template <class F>
+        requires(!std::is_same_v<std::remove_cvref_t<F>, InplaceFunction> &&
+                 std::is_invocable_r_v<R, std::decay_t<F>&, Args...>)
+    InplaceFunction(F&& fn)
+    {
+        using Fn = std::decay_t<F>;
+        if constexpr (std::is_constructible_v<bool, const Fn&>)
+        {
+            if (!static_cast<bool>(fn))
+                return;  // empty std::function / null function pointer
+        }
+
+        if constexpr (FitsInline<Fn>)
+        {
+            ::new (static_cast<void*>(_storage)) Fn(std::forward<F>(fn));
+            _ops = &InlineOps<Fn>;
+        }
+        else
+        {
+            ::new (static_cast<void*>(_storage)) Fn*(new Fn(std::forward<F>(fn)));
+            _ops = &HeapOps<Fn>;
+        }
+    }
+
+    InplaceFunction(InplaceFunction&& other) noexcept { MoveFrom(other); }
+
+    InplaceFunction& operator=(InplaceFunction&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    InplaceFunction& operator=(std::nullptr_t) noexcept
+    {
+        Reset();
+        return *this;
+    }
+
+    InplaceFunction(const InplaceFunction&) = delete;
+    InplaceFunction& operator=(const InplaceFunction&) = delete;
+
+    ~InplaceFunction() { Reset(); }
+
+    explicit operator bool() const noexcept { return _ops != nullptr; }
+
+    /** Invoke the target. Like `std::function`, callable through const; throws bad_function_call when empty. */
+    R operator()(Args... args) const
+    {
+        if (!_ops)
+            throw std::bad_function_call();
+        return _ops->Invoke(const_cast<std::byte*>(_storage), std::forward<Args>(args)...);
+    }
+
+    /** True when a callable of type @p F would be stored without a heap allocation. */
+    template <class F>
+    static constexpr bool FitsInline = sizeof(F) <= Capacity && alignof(F) <= alignof(std::max_align_t) &&
+                                       std::is_nothrow_move_constructible_v<F>;
+
+private:
+    struct Ops
+    {
+        R (*Invoke)(void* storage, Args&&... args);
+        void (*Move)(void* dst, void* src) noexcept;  // move-construct into dst, destroy src
+        void (*Destroy)(void* storage) noexcept;
+    };
+
+    template <class Fn>
+    static constexpr Ops InlineOps{
+        [](void* s, Args&&... args) -> R { return std::invoke(*static_cast<Fn*>(s), std::forward<Args>(args)...); },
+        [](void* dst, void* src) noexcept {
+            ::new (dst) Fn(std::move(*static_cast<Fn*>(src)));
+            static_cast<Fn*>(src)->~Fn();
+        },
+        [](void* s) noexcept { static_cast<Fn*>(s)->~Fn(); },
+    };
+
+    template <class Fn>
+    static constexpr Ops HeapOps{
+        [](void* s, Args&&... args) -> R { return std::invoke(**static_cast<Fn**>(s), std::forward<Args>(args)...); },
+        [](void* dst, void* src) noexcept { ::new (dst) Fn*(*static_cast<Fn**>(src)); },
+        [](void* s) noexcept { delete *static_cast<Fn**>(s); },
+    };
+
+    void MoveFrom(InplaceFunction& other) noexcept
+    {
+        if (other._ops)
+        {
+            other._ops->Move(_storage, other._storage);
+            _ops = std::exchange(other._ops, nullptr);
+        }
+    }
+
+    void Reset() noexcept
+    {
+        if (_ops)
+            std::exchange(_ops, nullptr)->Destroy(_storage);
+    }
+
+    const Ops* _ops = nullptr;
+    alignas(std::max_align_t) std::byte _storage[Capacity < sizeof(void*) ? sizeof(void*) : Capacity];
+};
+
+}  // namespace CS2Kit::Core
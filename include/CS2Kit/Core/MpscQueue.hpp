@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+
+namespace CS2Kit::Core
+{
+
+/** Link field for @ref MpscQueue; derive queued types from it. */
+struct MpscNode
+{
+    std::atomic<MpscNode*> Next{nullptr};
+};
+
+/**
+ * @brief Intrusive lock-free multi-producer / single-consumer FIFO (Vyukov's algorithm).
+ *
+ * Any thread may Push; exactly one thread (the game thread, for the kit's completion queues)
+ * may Pop. Push is one atomic exchange and never blocks or allocates. Pop may briefly report
+ * empty while a producer is between its two stores; the node shows up on a later Pop.
+ *
+ * The queue does not own its nodes: whatever is still linked when it is destroyed must be
+ * drained by the owner first.
+ */
+template <class T>
+class MpscQueue
+{
+public:
+    MpscQueue() : _head(&_stub), _tail(&_stub) {}
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    /** Any thread. */
+    void Push(T* item) noexcept { PushNode(item); }
+
+    /** Consumer thread only. Returns nullptr when nothing is (yet) visible. */
+    T* Pop() noexcept
+    {
+        MpscNode* tail = _tail;
+        MpscNode* next = tail->Next.load(std::memory_order_acquire);
+        if (tail == &_stub)
+        {
+            if (!next)
+                return nullptr;
+            _tail = next;
+            tail = next;
+            next = next->Next.load(std::memory_order_acquire);
+        }
+        if (next)
+        {
+            _tail = next;
+            return static_cast<T*>(tail);
+        }
+
+        // tail is the last linked node. If a producer has already swung _head past it, its link
+        // is in flight: report empty rather than spin.
+        if (tail != _head.load(std::memory_order_acquire))
+            return nullptr;
+
+        // Re-insert the stub behind tail so tail can be handed out.
+        PushNode(&_stub);
+        next = tail->Next.load(std::memory_order_acquire);
+        if (next)
+        {
+            _tail = next;
+            return static_cast<T*>(tail);
+        }
+        return nullptr;
+    }
+
+private:
+    void PushNode(MpscNode* node) noexcept
+    {
+        node->Next.store(nullptr, std::memory_order_relaxed);
+        MpscNode* prev = _head.exchange(node, std::memory_order_acq_rel);
+        prev->Next.store(node, std::memory_order_release);
+    }
+
+    MpscNode _stub;
+    alignas(64) std::atomic<MpscNode*> _head;  // producers
+    alignas(64) MpscNode* _tail;               // consumer
+};
+
+}  // namespace CS2Kit::Core
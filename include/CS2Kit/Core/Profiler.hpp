@@ -0,0 +1,244 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <source_location>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace CS2Kit::Sdk
+{
+class ServerCommand;
+}
+
+namespace CS2Kit::Core
+{
+
+/** Index of a named probe in one @ref Profiler; 0 means "not resolved yet". */
+using ProbeId = uint32_t;
+
+/** One probe's rolling-window figures, as reported by @ref Profiler::Snapshot. */
+struct ProbeStats
+{
+    std::string Name;
+    uint64_t Calls = 0;    /**< Samples recorded since the last reset. */
+    size_t Window = 0;     /**< Samples the percentiles are computed over (the most recent ones). */
+    double P50Us = 0.0;
+    double P99Us = 0.0;
+    double MaxUs = 0.0;    /**< Worst sample in the window. */
+    double WindowMs = 0.0; /**< Summed time of the window, the sort key: what eats the frame. */
+};
+
+/** One timed span of a trace capture. */
+struct TraceSpan
+{
+    int64_t StartNs;
+    uint32_t DurationNs;
+    ProbeId Probe;
+};
+
+/** A finished capture from @ref Profiler::TakeCapture; self-contained, so it can be written off-thread. */
+struct TraceCapture
+{
+    std::vector<TraceSpan> Spans;     /**< Oldest first. */
+    std::vector<std::string> Names;   /**< Probe names, [id - 1]. */
+    uint32_t Frames = 0;              /**< Game frames covered. */
+    uint64_t Dropped = 0;             /**< Spans overwritten because the ring filled up. */
+
+    /** Chrome trace-event JSON ("X" complete events), loadable in Perfetto or chrome://tracing. */
+    std::string ToChromeJson() const;
+};
+
+/**
+ * @brief Per-callback frame profiler (`Engine().Profiler`).
+ *
+ * The kit's dispatch points - scheduler timers (keyed by registration site), game-event
+ * listeners, MovementHook pre/post, CheckTransmit, the menu tick - open a @ref ProfileScope
+ * around each callback. Every probe keeps its last @ref WindowSize durations, from which
+ * @ref Snapshot derives p50/p99/max on demand; recording is O(1) and never allocates once the
+ * probe exists.
+ *
+ * The same scopes feed trace captures: @ref StartCapture records every span of the next N game
+ * frames into a ring preallocated up front, and the finished @ref TraceCapture exports Chrome
+ * trace-event JSON for Perfetto - a hitch can be inspected after the fact without attaching a
+ * profiler to a live server.
+ *
+ * Off by default. While neither stats nor a capture is on, a scope costs one predictable
+ * branch; building without `CS2KIT_ENABLE_PROFILER` compiles scopes out entirely. Toggle with
+ * @ref SetEnabled or the commands from @ref InstallCommand / @ref InstallTraceCommand; the
+ * kit's `profile` status section reports the top probes. Game thread only.
+ */
+class Profiler
+{
+public:
+    static constexpr size_t WindowSize = 512;
+    /** Ring capacity of a trace capture (16 bytes a span); older spans are overwritten past it. */
+    static constexpr size_t TraceCapacity = size_t{1} << 17;
+    /** Frames the trace command captures when given no count (about 5 s at 64 tick). */
+    static constexpr uint32_t DefaultTraceFrames = 300;
+
+    Profiler() = default;
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    /** Rolling per-probe stats on. */
+    bool Enabled() const { return _enabled; }
+    void SetEnabled(bool enabled)
+    {
+        _enabled = enabled;
+        _active = _enabled || _capturing;
+    }
+
+    /** Scopes should time: stats are on or a capture is running. */
+    bool Active() const { return _active; }
+
+    /** The probe named @p name, created on first use. Ids stay valid for this Profiler's lifetime. */
+    ProbeId Probe(std::string_view name);
+
+    /** Probe named "<kind> <file>:<line>" for a registration site (file reduced to its base name). */
+    ProbeId SiteProbe(std::string_view kind, const std::source_location& site);
+
+    /** Add one span to @p id (window stats and/or the running capture). Ignores unknown ids. */
+    void Record(ProbeId id, int64_t startNs, int64_t elapsedNs);
+
+    /** Bracket one game frame (CS2Kit::OnGameFrame does); drives the "GameFrame" probe and capture length. */
+    void BeginFrame();
+    void EndFrame();
+
+    /** Record the next @p frames game frames (restarts a running capture). */
+    void StartCapture(uint32_t frames);
+
+    /** End a running capture now; it becomes available to @ref TakeCapture. */
+    void StopCapture();
+
+    bool Capturing() const { return _capturing; }
+
+    /** The capture that finished since the last call, if any (hands over its buffer). */
+    std::optional<TraceCapture> TakeCapture();
+
+    /** Forget every sample; probes (and the ids callers cached) survive. */
+    void Reset();
+
+    /** Probes with at least one sample, heaviest window first; at most @p limit (0 = all). */
+    std::vector<ProbeStats> Snapshot(size_t limit = 0) const;
+
+    /** Aligned table of @ref Snapshot for the console. */
+    std::string BuildText(size_t limit = 20) const;
+
+    /**
+     * @brief Install the server command driving the profiler.
+     *
+     * `<name>` prints the table, `<name> on|off` toggles recording, `<name> reset` clears the
+     * windows. `name` and `helpText` must outlive the plugin; the command unregisters with
+     * the services.
+     */
+    void InstallCommand(const char* name, const char* helpText);
+
+    /**
+     * @brief Install the trace command: `<name> [frames]` captures that many frames (default
+     * 300), `<name> stop` ends early. CS2Kit::OnGameFrame writes the finished capture to
+     * `addons/cs2-kit/traces/` off the game thread and logs the path.
+     */
+    void InstallTraceCommand(const char* name, const char* helpText);
+
+    /** Monotonic nanoseconds, the clock every sample is taken with. */
+    static int64_t NowNs();
+
+private:
+    struct ProbeData
+    {
+        std::string Name;
+        uint64_t Calls = 0;
+        std::array<uint32_t, WindowSize> Samples{};  // ns, saturated; ring indexed by Calls
+    };
+
+    bool _enabled = false;
+    bool _active = false;
+    std::vector<std::unique_ptr<ProbeData>> _probes;  // [id - 1]
+    std::unordered_map<std::string, ProbeId> _byName;
+
+    bool _capturing = false;
+    bool _captureDone = false;
+    uint32_t _framesLeft = 0;
+    uint32_t _framesCaptured = 0;
+    std::vector<TraceSpan> _ring;  // sized TraceCapacity when a capture starts
+    uint64_t _ringWritten = 0;     // spans ever pushed this capture; head = _ringWritten % size
+    int64_t _frameStartNs = 0;
+    ProbeId _frameProbe = 0;
+    // shared_ptr: its deleter is bound where the command is made (ProfilerCommand.cpp, which
+    // needs tier1), so this class stays constructible in SDK-free builds.
+    std::shared_ptr<Sdk::ServerCommand> _command;
+    std::shared_ptr<Sdk::ServerCommand> _traceCommand;
+};
+
+/**
+ * @brief A fixed probe name resolved lazily against the Profiler of the same Services.
+ * Keep one as a member next to the dispatch it measures.
+ */
+class ProbePoint
+{
+public:
+    explicit constexpr ProbePoint(std::string_view name) : _name(name) {}
+
+    ProbeId Resolve(Profiler& profiler)
+    {
+        if (_id == 0)
+            _id = profiler.Probe(_name);
+        return _id;
+    }
+
+private:
+    std::string_view _name;
+    ProbeId _id = 0;
+};
+
+/** RAII timer feeding one probe; inert when the profiler is off (or compiled out). */
+class ProfileScope
+{
+public:
+#ifdef CS2KIT_ENABLE_PROFILER
+    ProfileScope(Profiler& profiler, ProbePoint& point)
+    {
+        if (profiler.Active())
+            Begin(profiler, point.Resolve(profiler));
+    }
+
+    ProfileScope(Profiler* profiler, ProbeId id)
+    {
+        if (profiler && id != 0 && profiler->Active())
+            Begin(*profiler, id);
+    }
+
+    ~ProfileScope()
+    {
+        if (_profiler)
+            _profiler->Record(_id, _startNs, Profiler::NowNs() - _startNs);
+    }
+#else
+    ProfileScope(Profiler&, ProbePoint&) {}
+    ProfileScope(Profiler*, ProbeId) {}
+#endif
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+#ifdef CS2KIT_ENABLE_PROFILER
+    void Begin(Profiler& profiler, ProbeId id)
+    {
+        _profiler = &profiler;
+        _id = id;
+        _startNs = Profiler::NowNs();
+    }
+
+    Profiler* _profiler = nullptr;
+    ProbeId _id = 0;
+    int64_t _startNs = 0;
+#endif
+};
+
+}  // namespace CS2Kit::Core
@@ -1,21 +1,25 @@
 #pragma once
 
+#include <CS2Kit/Core/Scheduler.hpp>
+#include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <memory>
+#include <vector>
 
 namespace CS2Kit::Core
 {
 
-class Scheduler;
-
 /**
  * @brief A repeating routine with an optional fixed lifetime, driven by a @ref Scheduler.
  *
  * `onTick` runs every `tickIntervalMs`. If `durationMs > 0` the effect auto-stops after that
  * long. `onStop` runs exactly once when the effect ends for any reason - duration elapsed,
  * Stop(), move-assignment, or destruction - making it the single place to undo whatever
- * `onTick` applied. Move-only; the underlying timers are cancelled when the last owner goes away.
+ * `onTick` applied. Move-only; the underlying timers are cancelled when the owner goes away.
+ *
+ * The effect's state lives in a @ref Pool slot and the object itself is a generation-checked
+ * handle to it: once the effect stops, the slot is recycled and the handle reads as inactive.
+ * Pass a pool sized for the worst case and construction is allocation-free; the overload
+ * without one uses @ref Pool::Shared.
  *
  * The @ref Scheduler is injected (not taken from the global @ref Engine), so the type is usable
  * in headless tests and never hides a global dependency.
@@ -29,13 +33,17 @@ class Scheduler;
 class ScheduledEffect
 {
 public:
+    class Pool;
+
     ScheduledEffect() = default;
-    ScheduledEffect(Scheduler& scheduler, int64_t tickIntervalMs, int64_t durationMs, std::function<void()> onTick,
-                    std::function<void()> onStop);
+    ScheduledEffect(Scheduler& scheduler, int64_t tickIntervalMs, int64_t durationMs, Scheduler::Callback onTick,
+                    Scheduler::Callback onStop);
+    ScheduledEffect(Pool& pool, Scheduler& scheduler, int64_t tickIntervalMs, int64_t durationMs,
+                    Scheduler::Callback onTick, Scheduler::Callback onStop);
     ~ScheduledEffect();
 
-    ScheduledEffect(ScheduledEffect&&) noexcept = default;
-    ScheduledEffect& operator=(ScheduledEffect&&) noexcept;
+    ScheduledEffect(ScheduledEffect&& other) noexcept;
+    ScheduledEffect& operator=(ScheduledEffect&& other) noexcept;
     ScheduledEffect(const ScheduledEffect&) = delete;
     ScheduledEffect& operator=(const ScheduledEffect&) = delete;
 
@@ -46,8 +54,48 @@ public:
     bool Active() const;
 
 private:
+    Pool* _pool = nullptr;
+    uint32_t _index = 0;
+    uint32_t _generation = 0;
+};
+
+/**
+ * @brief Fixed-capacity storage for @ref ScheduledEffect state.
+ *
+ * Slots are recycled through a free list and carry a generation counter that is bumped on
+ * every release, so a stale handle (or the auto-stop timer of an effect that already ended)
+ * can never reach the slot's next occupant. Running past the capacity grows the pool rather
+ * than failing; size it for the most effects alive at once and that never happens.
+ *
+ * The pool must outlive every effect built from it. Game-thread only, like the @ref Scheduler.
+ */
+class ScheduledEffect::Pool
+{
+public:
+    explicit Pool(size_t capacity);
+    ~Pool();
+    Pool(const Pool&) = delete;
+    Pool& operator=(const Pool&) = delete;
+
+    /** Slots allocated so far (the constructor's capacity unless the pool had to grow). */
+    size_t Capacity() const;
+
+    /** Slots held by running effects. */
+    size_t InUse() const;
+
+    /** Default pool for effects constructed without one. Never destroyed, so static effects are safe. */
+    static Pool& Shared();
+
+private:
+    friend class ScheduledEffect;
     struct State;
-    std::shared_ptr<State> _state;
+
+    uint32_t Acquire();
+    State* Find(uint32_t index, uint32_t generation);
+    void Stop(uint32_t index, uint32_t generation);
+
+    std::vector<State> _states;
+    std::vector<uint32_t> _free;  // LIFO: the slot just released is the one reused (still in cache)
 };
 
 }  // namespace CS2Kit::Core
@@ -1,57 +1,159 @@
 #pragma once
 
 #include <CS2Kit/Core/CallbackRegistry.hpp>
+#include <CS2Kit/Core/InplaceFunction.hpp>
+#include <CS2Kit/Core/Profiler.hpp>
+#include <array>
 #include <cstdint>
-#include <functional>
+#include <deque>
+#include <source_location>
+#include <vector>
 
 namespace CS2Kit::Core
 {
 
+/** Lane for @ref Scheduler::Defer; higher lanes drain first within the frame budget. */
+enum class DeferPriority
+{
+    High,
+    Normal,
+    Low
+};
+
+/** Deferred-lane counters, surfaced in the kit's `scheduler` status section. */
+struct DeferStats
+{
+    size_t Queued = 0;        /**< Items waiting across all priorities. */
+    uint64_t Executed = 0;    /**< Items run since load. */
+    uint64_t Overruns = 0;    /**< Frames whose drain exceeded the budget. */
+    int64_t LastDrainUs = 0;  /**< Time spent draining in the most recent frame that had work. */
+    int64_t BudgetUs = 0;     /**< Current per-frame budget. */
+};
+
 /**
  * @brief Tick-based task scheduler for one-shot delays and repeating timers.
  * Driven by `OnGameFrame()` (called every server tick from the plugin's GameFrame hook).
  * All callbacks execute on the game thread; no synchronization required.
+ *
+ * Timed entries sit in a min-heap keyed by fire time and every-frame entries in their own
+ * lane, so a frame costs O(timers due), not O(timers registered). Due timers fire in
+ * fire-time order (ties in registration order); a timer added by a callback never fires in
+ * the same frame, and a timer cancelled by an earlier callback in the batch is skipped.
+ *
+ * @ref Defer is the lane for bulk work that must not hitch a frame: after timers fire, queued
+ * items drain in priority order until the per-frame microsecond budget is spent, and the rest
+ * carries over. Split big jobs into many small Defer calls (one row, one slot) so the budget
+ * can cut between them.
+ *
+ * Every registration records its call site (the defaulted `site` argument; leave it alone),
+ * which names the timer's probe when a @ref Profiler is attached and enabled.
  */
 class Scheduler
 {
 public:
+    /** Timer body; closures up to @ref DefaultInplaceCapacity bytes are stored without allocating. */
+    using Callback = InplaceFunction<void()>;
+
+    using Site = std::source_location;
+
     Scheduler() = default;
 
     /** Run `callback` once after `delayMs` milliseconds. Returns a cancellation handle. */
-    uint64_t Delay(int64_t delayMs, std::function<void()> callback);
+    uint64_t Delay(int64_t delayMs, Callback callback, Site site = Site::current());
 
     /** Run `callback` every `intervalMs` milliseconds. Returns a cancellation handle. */
-    uint64_t Repeat(int64_t intervalMs, std::function<void()> callback);
+    uint64_t Repeat(int64_t intervalMs, Callback callback, Site site = Site::current());
 
     /** First fire after `delayMs`, then repeat every `intervalMs`. Returns a cancellation handle. */
-    uint64_t DelayAndRepeat(int64_t delayMs, int64_t intervalMs, std::function<void()> callback);
+    uint64_t DelayAndRepeat(int64_t delayMs, int64_t intervalMs, Callback callback, Site site = Site::current());
 
     /** Run `callback` on the very next game frame. */
-    uint64_t NextTick(std::function<void()> callback);
+    uint64_t NextTick(Callback callback, Site site = Site::current());
 
     /** Run `callback` every game frame until cancelled (e.g. a completion pump). */
-    uint64_t EveryFrame(std::function<void()> callback);
+    uint64_t EveryFrame(Callback callback, Site site = Site::current());
 
     /** Cancel a timer by handle. Safe to call with an unknown id. */
     void Cancel(uint64_t id);
 
-    /** Cancel all pending timers. */
+    /**
+     * @brief Queue @p callback on the budgeted deferred lane (FIFO within a priority).
+     *
+     * At least one item runs per frame, so a tiny budget still makes progress. A lower
+     * priority passed over for @ref MaxDeferWaitFrames frames in a row gets its oldest item
+     * run first on the next frame, so a steady stream of High work cannot starve Low forever.
+     */
+    void Defer(DeferPriority priority, Callback callback);
+
+    /** Per-frame time budget for the deferred lane. Non-positive means one item per frame. */
+    void SetDeferBudgetUs(int64_t budgetUs) { _deferBudgetUs = budgetUs; }
+
+    DeferStats GetDeferStats() const;
+
+    /** Time each timer (by registration site), the whole frame, and the deferred drain. Null detaches. */
+    void SetProfiler(Profiler* profiler) { _profiler = profiler; }
+
+    /** Live timers, every-frame pumps included. */
+    size_t TimerCount() const { return _timers.Size(); }
+
+    /** Cancel all pending timers and drop every deferred item. */
     void CancelAll();
 
     /** Drive the scheduler (call from your `GameFrame` hook or via `CS2Kit::OnGameFrame()`). */
     void OnGameFrame();
 
+    static constexpr int64_t DefaultDeferBudgetUs = 1000;
+    static constexpr uint32_t MaxDeferWaitFrames = 16;
+
 private:
+    static constexpr size_t DeferLanes = 3;
+
     struct Timer
     {
         int64_t NextFireTime;
         int64_t Interval;
-        std::function<void()> Callback;
+        Scheduler::Callback Callback;
+        Site Registered;
+        ProbeId Probe = 0;    // resolved on the first profiled fire
+        bool Queued = false;  // has a live entry in _queue (every-frame timers never do)
+    };
+
+    /** Heap entry; cancelled timers leave theirs behind and are skipped when popped. */
+    struct QueueEntry
+    {
+        int64_t FireTime;
+        uint64_t Seq;  // push order; breaks FireTime ties (handles are not monotonic)
+        uint64_t Id;
     };
 
     int64_t GetCurrentTimeMs() const;
+    void FireTimers();
+    void DrainDeferred();
+    uint64_t AddTimed(int64_t fireTime, int64_t interval, Callback callback, const Site& site);
+    void Push(uint64_t id, Timer& timer);
+    void CompactQueue();
+
+    /** Invoke timer @p id; returns false once it is gone (cancelled by its own callback). */
+    bool Fire(uint64_t id);
 
     CallbackRegistry<Timer> _timers;
+    std::vector<QueueEntry> _queue;     // min-heap on (FireTime, Seq)
+    std::vector<uint64_t> _everyFrame;  // every-frame lane, registration order
+    std::vector<uint64_t> _due;         // per-frame scratch, kept to reuse its capacity
+    size_t _staleEntries = 0;           // _queue entries whose timer was cancelled
+    uint64_t _nextSeq = 0;
+    uint64_t _clearEpoch = 0;           // bumped by CancelAll so a frame in progress stops
+
+    std::array<std::deque<Callback>, DeferLanes> _deferred;  // indexed by DeferPriority
+    std::array<uint32_t, DeferLanes> _deferWaited{};          // consecutive frames each lane was passed over
+    int64_t _deferBudgetUs = DefaultDeferBudgetUs;
+    uint64_t _deferExecuted = 0;
+    uint64_t _deferOverruns = 0;
+    int64_t _lastDrainUs = 0;
+
+    Profiler* _profiler = nullptr;
+    ProbePoint _frameProbe{"scheduler.frame"};
+    ProbePoint _deferProbe{"scheduler.defer"};
 };
 
 }  // namespace CS2Kit::Core
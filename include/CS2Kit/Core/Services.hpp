@@ -3,8 +3,11 @@
 #include <CS2Kit/Commands/CommandManager.hpp>
 #include <CS2Kit/Core/LoadReport.hpp>
 #include <CS2Kit/Core/PluginPolicy.hpp>
+#include <CS2Kit/Core/Profiler.hpp>
 #include <CS2Kit/Core/Scheduler.hpp>
 #include <CS2Kit/Core/StatusService.hpp>
+#include <CS2Kit/Core/Task.hpp>
+#include <CS2Kit/Core/ThreadPool.hpp>
 #include <CS2Kit/Http/HttpClient.hpp>
 #include <CS2Kit/Menu/MenuManager.hpp>
 #include <CS2Kit/Players/PlayerManager.hpp>
@@ -17,7 +20,10 @@
 #include <CS2Kit/Sdk/GameInterfaces.hpp>
 #include <CS2Kit/Sdk/InputHistoryService.hpp>
 #include <CS2Kit/Sdk/MovementHook.hpp>
+#include <CS2Kit/Sdk/OffsetCache.hpp>
+#include <CS2Kit/Sdk/PlayerSnapshot.hpp>
 #include <CS2Kit/Sdk/PrecacheService.hpp>
+#include <CS2Kit/Sdk/SpatialService.hpp>
 #include <CS2Kit/Sdk/TransmitFilter.hpp>
 #include <CS2Kit/Sdk/UserMessage.hpp>
 #include <CS2Kit/Utils/Translations.hpp>
@@ -56,10 +62,18 @@ public:
     Core::LoadReport LoadReport;
     /** Status sections for diagnostics commands; kit sections registered during load. */
     Core::StatusService Status;
+    /** Per-callback frame timings; off until enabled, reported in the `profile` status section. */
+    Core::Profiler Profiler;
     Sdk::GameInterfaces Interfaces;  // plain interface-pointer holder; populated in CS2Kit::Initialize
+    /** Signature matches and schema offsets persisted across loads of the same game build. */
+    Sdk::OffsetCache OffsetCache;
     Sdk::GameData GameData;
     Sdk::MessageSystem Messages;
     Sdk::EntitySystem Entities;
+    /** Per-slot controller/pawn state captured once per GameFrame; PlayerController writes invalidate a slot. */
+    Sdk::PlayerSnapshot Snapshot;
+    /** Grid of alive-player and opted-in entity origins, refreshed after each Snapshot capture. */
+    Sdk::SpatialService Spatial;
     Sdk::EntityOpsService EntityOps;
     Sdk::TransmitFilterService Transmit;
     Sdk::PrecacheService Precache;
@@ -68,6 +82,8 @@ public:
     Sdk::MovementHook MovementHook;
     Sdk::GameEventService Events;
     Core::Scheduler Scheduler;
+    /** Off-thread CPU work; completions dispatch from the OnGameFrame pump, Shutdown joins the workers. */
+    Core::ThreadPool ThreadPool;
     Sdk::ChatInputCapture ChatInput;
     Utils::Translations Translations;
     Players::PlayerManager Players;
@@ -77,6 +93,12 @@ public:
     Menu::MenuManager Menus;
     /** Completions dispatch on the game thread from the OnGameFrame pump; Shutdown stops it. */
     Http::HttpClient Http;
+    /**
+     * Spawned coroutine Tasks; Shutdown cancels them while the services they await still exist.
+     * Declared last so that, when Shutdown is skipped, ~TaskHost destroys suspended frames (and
+     * their awaiters, e.g. ChatInput's) before any service they reference.
+     */
+    Core::TaskHost Tasks;
 
     /** Internal schema-offset service (forward-declared type). */
     Sdk::SchemaService& Schema() { return *_schema; }
@@ -0,0 +1,274 @@
+#pragma once
+
+#include <CS2Kit/Core/CallbackRegistry.hpp>
+#include <CS2Kit/Core/Scheduler.hpp>
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace CS2Kit::Core
+{
+
+class TaskHost;
+
+namespace Detail
+{
+/** Size-classed free-list pool backing every Task frame. Game thread only. */
+void* AllocateFrame(size_t size);
+void FreeFrame(void* frame, size_t size) noexcept;
+}  // namespace Detail
+
+/**
+ * @brief What an awaitable keeps to resume its coroutine later: the owning root task and the
+ * handle to resume. Calling it resumes only if the root is still alive, so a completion that
+ * arrives after the task was cancelled is dropped instead of touching a destroyed frame.
+ * Three pointers, so it fits inline in every kit callback type.
+ */
+struct ResumeToken
+{
+    TaskHost* Host = nullptr;
+    uint64_t Root = 0;
+    std::coroutine_handle<> Handle;
+
+    bool Alive() const;
+    void operator()() const;
+};
+
+/** Promise state shared by every Task<T>; awaitables read the token from it. */
+struct TaskPromiseBase
+{
+    std::coroutine_handle<> Continuation;  // the awaiting parent; null for a root task
+    TaskHost* Host = nullptr;
+    uint64_t Root = 0;
+    std::exception_ptr Error;
+
+    static void* operator new(size_t size) { return Detail::AllocateFrame(size); }
+    static void operator delete(void* frame, size_t size) noexcept { Detail::FreeFrame(frame, size); }
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+
+    struct FinalAwaiter
+    {
+        bool await_ready() const noexcept { return false; }
+        template <class P>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<P> h) noexcept
+        {
+            return h.promise().Complete(h);
+        }
+        void await_resume() const noexcept {}
+    };
+    FinalAwaiter final_suspend() noexcept { return {}; }
+
+    void unhandled_exception() noexcept { Error = std::current_exception(); }
+
+    /** Hand control to the parent, or (for a root) let the host reclaim the frame. */
+    std::coroutine_handle<> Complete(std::coroutine_handle<> self) noexcept;
+
+    ResumeToken Token(std::coroutine_handle<> self) const { return {Host, Root, self}; }
+};
+
+/** A coroutine whose promise the kit's awaitables understand (i.e. a Task body). */
+template <class P>
+concept TaskPromise = std::derived_from<P, TaskPromiseBase>;
+
+namespace Detail
+{
+template <class T>
+struct TaskResult : TaskPromiseBase
+{
+    std::optional<T> Value;
+    void return_value(T value) { Value.emplace(std::move(value)); }
+    T Take()
+    {
+        if (Error)
+            std::rethrow_exception(Error);
+        return std::move(*Value);
+    }
+};
+
+template <>
+struct TaskResult<void> : TaskPromiseBase
+{
+    void return_void() noexcept {}
+    void Take()
+    {
+        if (Error)
+            std::rethrow_exception(Error);
+    }
+};
+}  // namespace Detail
+
+/**
+ * @brief Lazily-started coroutine that always runs on the game thread.
+ *
+ * Write multi-step async flows top to bottom instead of as nested callbacks:
+ *
+ * @code
+ * CS2Kit::Task<> BanFlow(int admin, int64_t steamId)
+ * {
+ *     auto row = co_await db.QueryAsync("ban_lookup", sql, pqxx::params{steamId});
+ *     if (!row) co_return;
+ *     auto res = co_await Engine().Http.PostAsync(webhookUrl, Payload(*row));
+ *     co_await CS2Kit::Core::Sleep(Engine().Scheduler, 3000);
+ *     Engine().Messages.Reply(admin, res.Ok ? "done" : "webhook failed");
+ * }
+ *
+ * Engine().Tasks.Spawn(BanFlow(slot, target));
+ * @endcode
+ *
+ * A Task does nothing until it is awaited by another Task or handed to @ref TaskHost::Spawn.
+ * Every kit awaitable resumes from the game-thread dispatch of the thing awaited (scheduler
+ * frame, HTTP/DB completion pump, chat input), so code after a `co_await` may touch engine
+ * state freely. Frames come from a pooled allocator. Exceptions propagate to the awaiting
+ * parent; one escaping a root task is logged.
+ */
+template <class T = void>
+class [[nodiscard]] Task
+{
+public:
+    struct promise_type : Detail::TaskResult<T>
+    {
+        Task get_return_object() { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+    };
+
+    Task(Task&& other) noexcept : _handle(std::exchange(other._handle, {})) {}
+    Task& operator=(Task&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (_handle)
+                _handle.destroy();
+            _handle = std::exchange(other._handle, {});
+        }
+        return *this;
+    }
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    ~Task()
+    {
+        if (_handle)
+            _handle.destroy();
+    }
+
+    struct Awaiter
+    {
+        std::coroutine_handle<promise_type> Child;
+
+        bool await_ready() const noexcept { return !Child || Child.done(); }
+
+        template <TaskPromise P>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<P> parent) noexcept
+        {
+            auto& child = Child.promise();
+            child.Continuation = parent;
+            child.Host = parent.promise().Host;
+            child.Root = parent.promise().Root;
+            return Child;
+        }
+
+        T await_resume() { return Child.promise().Take(); }
+    };
+
+    /** Awaiting a Task starts it; the parent resumes when it finishes and inherits its root. */
+    Awaiter operator co_await() && noexcept { return Awaiter{_handle}; }
+
+private:
+    friend class TaskHost;
+
+    explicit Task(std::coroutine_handle<promise_type> handle) : _handle(handle) {}
+
+    std::coroutine_handle<promise_type> Release() { return std::exchange(_handle, {}); }
+
+    std::coroutine_handle<promise_type> _handle;
+};
+
+/**
+ * @brief Owns every running root Task for one Load/Unload cycle (`Engine().Tasks`).
+ *
+ * @ref Spawn starts a task and keeps its frame until it finishes. @ref CancelAll (run by
+ * `CS2Kit::Shutdown`, and by the destructor) destroys every suspended task, unwinding its
+ * locals; completions that arrive later find the task gone and are dropped. Cancelling a task
+ * that is currently running (itself, or an ancestor of the caller) is deferred until it next
+ * suspends, then it is destroyed without resuming.
+ */
+class TaskHost
+{
+public:
+    TaskHost() = default;
+    ~TaskHost() { CancelAll(); }
+    TaskHost(const TaskHost&) = delete;
+    TaskHost& operator=(const TaskHost&) = delete;
+
+    /** Start @p task; it runs inline until its first suspension. Returns its handle, or 0 if it already finished. */
+    template <class T>
+    uint64_t Spawn(Task<T> task)
+    {
+        auto handle = task.Release();
+        if (!handle)
+            return 0;
+        auto& promise = handle.promise();
+        promise.Host = this;
+        promise.Root = _roots.Add(handle);
+        const uint64_t root = promise.Root;
+        Resume(root, handle);
+        return Alive(root) ? root : 0;
+    }
+
+    bool Alive(uint64_t root) const { return _roots.Contains(root); }
+
+    /** Destroy a spawned task. Safe with an unknown or finished id. */
+    void Cancel(uint64_t root);
+
+    void CancelAll();
+
+    size_t Count() const { return _roots.Size(); }
+
+    /** Resume @p handle on behalf of @p root, if the root is still alive. Used by @ref ResumeToken. */
+    void Resume(uint64_t root, std::coroutine_handle<> handle);
+
+    /** Final step of a root task: drop it from the registry and free its frame. */
+    void Finish(uint64_t root, std::coroutine_handle<> handle, std::exception_ptr error) noexcept;
+
+private:
+    void Destroy(std::coroutine_handle<> handle);
+
+    CallbackRegistry<std::coroutine_handle<>> _roots;
+    std::vector<std::coroutine_handle<>> _doomed;  // cancelled while something was running
+    int _running = 0;                              // Resume nesting depth
+};
+
+/** Awaitable that resumes after @p delayMs on @p scheduler (0 = the next frame). */
+struct SleepAwaiter
+{
+    Scheduler& Sched;
+    int64_t DelayMs;
+    Scheduler::Site Site;  // the co_await, so the profiler names the wake-up after it
+
+    bool await_ready() const noexcept { return false; }
+    template <TaskPromise P>
+    void await_suspend(std::coroutine_handle<P> h)
+    {
+        Sched.Delay(DelayMs, h.promise().Token(h), Site);
+    }
+    void await_resume() const noexcept {}
+};
+
+/** `co_await Sleep(Engine().Scheduler, 500);` */
+inline SleepAwaiter Sleep(Scheduler& scheduler, int64_t delayMs, Scheduler::Site site = Scheduler::Site::current())
+{
+    return {scheduler, delayMs, site};
+}
+
+/** `co_await NextFrame(Engine().Scheduler);` */
+inline SleepAwaiter NextFrame(Scheduler& scheduler, Scheduler::Site site = Scheduler::Site::current())
+{
+    return {scheduler, 0, site};
+}
+
+}  // namespace CS2Kit::Core
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <CS2Kit/Core/MpscQueue.hpp>
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace CS2Kit::Core
+{
+
+/**
+ * @brief Kit-owned worker pool for off-thread CPU work (`Engine().ThreadPool`).
+ *
+ * @code
+ * Engine().ThreadPool.Run(
+ *     [samples = std::move(samples)] { return ScoreAngles(samples); },  // worker thread
+ *     [slot](double score) { Engine().Players.Get(slot)...; });          // game thread
+ * @endcode
+ *
+ * Each worker owns a deque: it pops its own newest job and, when that runs dry, steals the
+ * oldest job from a sibling. Finished jobs go onto one lock-free MPSC queue that
+ * @ref DispatchCompletions (a Scheduler pump registered by Initialize) drains on the game
+ * thread, so `onDone` may touch engine and plugin state freely. The work function itself must
+ * not: it runs concurrently with the game, so give it everything it needs by value.
+ *
+ * Threads start on the first Run. @ref Stop (from `CS2Kit::Shutdown`, and the destructor) lets
+ * running jobs finish, discards queued ones, joins every worker, and destroys undispatched
+ * completions unrun - `meta reload` never leaves a thread executing in an unmapped DLL.
+ */
+class ThreadPool
+{
+public:
+    ThreadPool() = default;
+    ~ThreadPool();
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /** Spawn @p threads workers (0 = pick from the core count). No-op once started. */
+    void Start(size_t threads = 0);
+
+    /** Finish running jobs, drop queued ones and their completions, join. Idempotent. */
+    void Stop();
+
+    /**
+     * Run @p work on a worker. When it returns, @p onDone runs on the game thread - with the
+     * work's result if it returns one. A job that throws skips onDone and logs the exception.
+     * Call from the game thread, or from inside other pool work (which then queues locally).
+     */
+    template <class Work, class Done>
+        requires std::invocable<Work&>
+    void Run(Work work, Done onDone)
+    {
+        Submit(std::make_unique<TypedJob<Work, Done>>(std::move(work), std::move(onDone)));
+    }
+
+    /** Fire-and-forget form of Run. */
+    template <class Work>
+        requires std::invocable<Work&>
+    void Run(Work work)
+    {
+        Run(std::move(work), NoCompletion{});
+    }
+
+    /** Invoke ready completions on the calling (game) thread. Initialize registers this as a pump. */
+    void DispatchCompletions();
+
+    size_t ThreadCount() const { return _workers.size(); }
+    /** Jobs submitted but not yet picked up by a worker. */
+    size_t Queued() const { return _queued.load(std::memory_order_relaxed); }
+    /** Completions dispatched since Start. */
+    uint64_t Completed() const { return _completed; }
+
+private:
+    struct NoCompletion
+    {
+        void operator()() const noexcept {}
+    };
+
+    struct Job : MpscNode
+    {
+        virtual ~Job() = default;
+        virtual void Execute() = 0;   // worker thread
+        virtual void Complete() = 0;  // game thread
+        std::exception_ptr Error;
+    };
+
+    template <class Work, class Done>
+    struct TypedJob final : Job
+    {
+        using Result = std::invoke_result_t<Work&>;
+
+        TypedJob(Work work, Done done) : WorkFn(std::move(work)), DoneFn(std::move(done)) {}
+
+        void Execute() override
+        {
+            if constexpr (std::is_void_v<Result>)
+                WorkFn();
+            else
+                Value.emplace(WorkFn());
+        }
+
+        void Complete() override
+        {
+            if constexpr (std::is_void_v<Result>)
+                DoneFn();
+            else
+                DoneFn(std::move(*Value));
+        }
+
+        Work WorkFn;
+        Done DoneFn;
+        [[no_unique_address]] std::conditional_t<std::is_void_v<Result>, std::monostate, std::optional<Result>> Value;
+    };
+
+    struct Worker
+    {
+        std::mutex Mutex;
+        std::deque<Job*> Jobs;  // owner pops the back, thieves take the front
+        std::thread Thread;
+    };
+
+    void Submit(std::unique_ptr<Job> job);
+    void WorkerMain(size_t index);
+    Job* TakeJob(size_t index);
+
+    std::vector<std::unique_ptr<Worker>> _workers;
+    std::mutex _sleepMutex;
+    std::condition_variable _wake;
+    std::atomic<size_t> _queued{0};
+    std::atomic<size_t> _nextWorker{0};
+    std::atomic<bool> _stopping{false};  // set under _sleepMutex
+    std::atomic<bool> _stopped{false};   // Stop() has run
+
+    MpscQueue<Job> _completions;
+    uint64_t _completed = 0;
+};
+
+}  // namespace CS2Kit::Core
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <CS2Kit/Core/Profiler.hpp>
+#include <CS2Kit/Core/Task.hpp>
 #include <CS2Kit/Database/DbResult.hpp>
 #include <chrono>
 #include <condition_variable>
@@ -56,6 +58,33 @@ class PostgresDatabase
 public:
     using ResultCallback = std::move_only_function<void(DbResult<pqxx::result>)>;
 
+    /** Awaitable form of Query for @ref Core::Task bodies; resumes on the game thread with the result. */
+    class QueryAwaiter
+    {
+    public:
+        bool await_ready() const noexcept { return false; }
+        template <Core::TaskPromise P>
+        void await_suspend(std::coroutine_handle<P> h)
+        {
+            Send(h.promise().Token(h));
+        }
+        DbResult<pqxx::result> await_resume() { return std::move(_result); }
+
+    private:
+        friend class PostgresDatabase;
+        QueryAwaiter(PostgresDatabase& db, std::string name, std::string sql, pqxx::params params)
+            : _db(db), _name(std::move(name)), _sql(std::move(sql)), _params(std::move(params))
+        {
+        }
+        void Send(Core::ResumeToken token);
+
+        PostgresDatabase& _db;
+        std::string _name;
+        std::string _sql;
+        pqxx::params _params;
+        DbResult<pqxx::result> _result = std::unexpected(std::string("pending"));
+    };
+
     PostgresDatabase() = default;
     ~PostgresDatabase();
     PostgresDatabase(const PostgresDatabase&) = delete;
@@ -74,6 +103,12 @@ public:
     /** Run a named prepared statement off-thread; @p onDone runs on the game thread later. */
     void Query(std::string name, std::string sql, pqxx::params params, ResultCallback onDone);
 
+    /** `auto rows = co_await db.QueryAsync("name", sql, pqxx::params{...});` */
+    QueryAwaiter QueryAsync(std::string name, std::string sql, pqxx::params params = {})
+    {
+        return {*this, std::move(name), std::move(sql), std::move(params)};
+    }
+
     /** Fire-and-forget write; failures are logged with @p name. */
     void Exec(std::string name, std::string sql, pqxx::params params = {});
 
@@ -128,6 +163,7 @@ private:
 
     std::thread _worker;
     uint64_t _pumpId = 0;
+    Core::ProbePoint _probe{"db.completion"};
 
     // Worker-thread-only state (no lock needed).
     std::unique_ptr<pqxx::connection> _connection;
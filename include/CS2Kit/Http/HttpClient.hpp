@@ -2,6 +2,7 @@
 
 #include "HttpResult.hpp"
 
+#include <CS2Kit/Core/Task.hpp>
 #include <memory>
 #include <string>
 #include <vector>
@@ -17,6 +18,37 @@ namespace CS2Kit::Http
 class HttpClient
 {
 public:
+    /** Awaitable form of Get/Post for @ref Core::Task bodies; resumes on the game thread with the result. */
+    class Awaiter
+    {
+    public:
+        bool await_ready() const noexcept { return false; }
+        template <Core::TaskPromise P>
+        void await_suspend(std::coroutine_handle<P> h)
+        {
+            Send(h.promise().Token(h));
+        }
+        HttpResult await_resume() { return std::move(_result); }
+
+    private:
+        friend class HttpClient;
+        Awaiter(HttpClient& client, bool post, std::string url, std::string body, std::vector<std::string> headers,
+                long timeoutMs)
+            : _client(client), _post(post), _url(std::move(url)), _body(std::move(body)),
+              _headers(std::move(headers)), _timeoutMs(timeoutMs)
+        {
+        }
+        void Send(Core::ResumeToken token);
+
+        HttpClient& _client;
+        bool _post;
+        std::string _url;
+        std::string _body;
+        std::vector<std::string> _headers;
+        long _timeoutMs;
+        HttpResult _result;
+    };
+
     HttpClient();
     ~HttpClient();
     HttpClient(const HttpClient&) = delete;
@@ -38,6 +70,21 @@ public:
     /** Enqueue an async GET. Same threading contract as Post. */
     void Get(std::string url, std::vector<std::string> headers, long timeoutMs, HttpCompletion onComplete);
 
+    /** `HttpResult r = co_await Engine().Http.PostAsync(url, body, headers);` */
+    Awaiter PostAsync(std::string url, std::string body, std::vector<std::string> headers = {},
+                      long timeoutMs = DefaultTimeoutMs)
+    {
+        return {*this, true, std::move(url), std::move(body), std::move(headers), timeoutMs};
+    }
+
+    /** `HttpResult r = co_await Engine().Http.GetAsync(url);` */
+    Awaiter GetAsync(std::string url, std::vector<std::string> headers = {}, long timeoutMs = DefaultTimeoutMs)
+    {
+        return {*this, false, std::move(url), {}, std::move(headers), timeoutMs};
+    }
+
+    static constexpr long DefaultTimeoutMs = 10000;
+
     /** Invoke all ready completions on the calling (game) thread. */
     void DispatchCompletions();
 
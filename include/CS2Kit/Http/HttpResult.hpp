@@ -1,6 +1,6 @@
 #pragma once
 
-#include <functional>
+#include <CS2Kit/Core/InplaceFunction.hpp>
 #include <string>
 
 namespace CS2Kit::Http
@@ -15,6 +15,6 @@ struct HttpResult
     std::string Error;  // populated when Ok == false
 };
 
-using HttpCompletion = std::function<void(const HttpResult&)>;
+using HttpCompletion = Core::InplaceFunction<void(const HttpResult&)>;
 
 }  // namespace CS2Kit::Http
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <CS2Kit/Core/Profiler.hpp>
 #include <CS2Kit/Core/Slot.hpp>
 #include <CS2Kit/Menu/Menu.hpp>
 #include <array>
@@ -53,6 +54,7 @@ private:
     std::array<PlayerMenuState, Core::MaxPlayers> _states;
     static constexpr int64_t InputDebounceMs = 200;
     bool _freezePlayer = false;
+    Core::ProbePoint _probe{"menus.frame"};
 };
 
 }  // namespace CS2Kit::Menu
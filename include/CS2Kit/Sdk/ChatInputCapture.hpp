@@ -1,6 +1,7 @@
 #pragma once
 
 #include <CS2Kit/Core/Slot.hpp>
+#include <CS2Kit/Core/Task.hpp>
 #include <array>
 #include <cstdint>
 #include <functional>
@@ -32,12 +33,54 @@ public:
     /** Validator return: true = accept and clear; false = re-prompt and keep waiting. */
     using Callback = std::function<bool(int slot, std::string_view text)>;
 
+    /** Fired when a capture ends without an accepted value (timeout, replacement, cancel, disconnect). */
+    using CancelCallback = std::function<void(int slot)>;
+
+    /** Awaitable form of BeginCapture: yields the accepted line, or nullopt if the capture was cancelled. */
+    class ReadAwaiter
+    {
+    public:
+        bool await_ready() const noexcept { return false; }
+        template <Core::TaskPromise P>
+        bool await_suspend(std::coroutine_handle<P> h)
+        {
+            return Send(h.promise().Token(h));
+        }
+        std::optional<std::string> await_resume() { return std::move(_result); }
+
+        /** Ends this awaiter's capture if it is still pending: the task was cancelled mid-wait. */
+        ~ReadAwaiter();
+
+    private:
+        friend class ChatInputCapture;
+        ReadAwaiter(ChatInputCapture& capture, int slot, std::string prompt, int timeoutMs)
+            : _capture(capture), _slot(slot), _prompt(std::move(prompt)), _timeoutMs(timeoutMs)
+        {
+        }
+        bool Send(Core::ResumeToken token);
+
+        ChatInputCapture& _capture;
+        int _slot;
+        std::string _prompt;
+        int _timeoutMs;
+        uint64_t _captureId = 0;  // the capture Send began; 0 before Send
+        std::optional<std::string> _result;
+    };
+
     /**
      * Begin capturing the next chat line from @p slot. If a previous capture is
      * still active, it is replaced (silently cancelled). The capture auto-cancels
-     * after @p timeoutMs without input.
+     * after @p timeoutMs without input. @p onCancel, if set, runs whenever the
+     * capture ends without the validator accepting a line.
      */
-    void BeginCapture(int slot, std::string prompt, Callback callback, int timeoutMs = 30000);
+    void BeginCapture(int slot, std::string prompt, Callback callback, int timeoutMs = 30000,
+                      CancelCallback onCancel = {});
+
+    /** `auto name = co_await Engine().ChatInput.ReadAsync(slot, "Enter a name");` */
+    ReadAwaiter ReadAsync(int slot, std::string prompt, int timeoutMs = 30000)
+    {
+        return {*this, slot, std::move(prompt), timeoutMs};
+    }
 
     /** True if @p slot currently has a pending prompt. */
     bool IsCapturing(int slot) const;
@@ -48,7 +91,7 @@ public:
      */
     bool TryConsume(int slot, std::string_view text);
 
-    /** Cancel without firing the callback. */
+    /** Cancel without firing the callback (the cancel callback, if any, does run). */
     void CancelCapture(int slot);
 
     /** The active prompt for @p slot, or nullptr if no capture is pending. */
@@ -62,10 +105,13 @@ private:
     {
         std::string Prompt;
         Callback Cb;
+        CancelCallback OnCancel;
         uint64_t TimeoutHandle = 0;
+        uint64_t Id = 0;  // tells a slot's successive captures apart
     };
 
     std::array<std::optional<Pending>, Core::MaxPlayers> _pending{};
+    uint64_t _nextId = 0;
 };
 
 }  // namespace CS2Kit::Sdk
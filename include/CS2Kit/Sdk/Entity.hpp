@@ -1,8 +1,14 @@
 #pragma once
 
+#include <CS2Kit/Core/CallbackRegistry.hpp>
+#include <CS2Kit/Core/InplaceFunction.hpp>
 #include <CS2Kit/Core/Slot.hpp>
+#include <CS2Kit/Sdk/EntityClassIndex.hpp>
+#include <CS2Kit/Sdk/EntityRange.hpp>
 #include <cstdint>
+#include <memory>
 #include <string>
+#include <string_view>
 
 class CGameEntitySystem;
 class CEntityInstance;
@@ -47,13 +53,29 @@ inline constexpr int MaxPlayers = Core::MaxPlayers;
  * @brief Entity system access layer for the Source 2 engine.
  * Resolves CGameEntitySystem from IGameResourceService, provides player
  * controller lookup by slot, entity handle resolution, and button state reading.
+ *
+ * Once attached, an entity listener keeps a designer-name index of every live entity
+ * (@ref ForEachByClass) and fans create/delete notifications out to plugin callbacks.
+ * The listener attaches in Initialize when a map is already running, and again on every
+ * server startup, because the engine builds a new entity system per map.
  */
 class EntitySystem
 {
 public:
-    EntitySystem() = default;
+    using EntityCallback = Core::InplaceFunction<void(CEntityInstance* entity)>;
+
+    EntitySystem();
+    ~EntitySystem();
+    EntitySystem(const EntitySystem&) = delete;
+    EntitySystem& operator=(const EntitySystem&) = delete;
 
     bool Initialize();
+
+    /** Re-resolve the (new) entity system, attach the listener to it and re-seed the class index. */
+    void OnServerStartup();
+
+    /** Detach the listener. Called by CS2Kit::Shutdown, before the plugin's code is unmapped. */
+    void Shutdown();
     CGameEntitySystem* GetEntitySystem();
     CEntityInstance* GetPlayerController(int slot);
 
@@ -85,8 +107,49 @@ public:
      *  nullptr when exhausted or the finder signature is unresolved. */
     CEntityInstance* FindByName(CEntityInstance* startAfter, const char* name);
 
+    /** Entity at network index @p index, or nullptr for a free slot. */
+    CEntityInstance* GetEntityByIndex(int index);
+
+    /**
+     * Live entities in index order, walking the identity chunks directly. With @p designerName,
+     * only entities of exactly that class are kept (pointer compare, see @ref EntityRange).
+     * Empty when the entity system is unavailable.
+     */
+    EntityRange Iterate(const char* designerName = nullptr);
+
+    /**
+     * Call @p fn(CEntityInstance*) for every live entity whose designer name matches
+     * @p pattern: exact (`"func_door"`) or a prefix ending in `*` (`"weapon_*"`). Reads the
+     * kit's class index, so the cost is O(matches) with no engine list walk. Empty until
+     * the listener has attached (see the class docs).
+     */
+    template <typename Fn>
+    void ForEachByClass(std::string_view pattern, Fn&& fn)
+    {
+        _classIndex.ForEach(pattern, [&](int index) {
+            if (auto* entity = GetEntityByIndex(index))
+                fn(entity);
+        });
+    }
+
+    /** Number of live entities matching @p pattern (same syntax as ForEachByClass). */
+    size_t CountByClass(std::string_view pattern) const { return _classIndex.Count(pattern); }
+
+    /** Called for each entity after the engine creates it; its designer name is already set. */
+    uint64_t ListenEntityCreated(EntityCallback callback) { return _created.Add(std::move(callback)); }
+
+    /** Called for each entity just before the engine frees it. */
+    uint64_t ListenEntityDeleted(EntityCallback callback) { return _deleted.Add(std::move(callback)); }
+
+    void RemoveEntityListener(uint64_t id);
+
 private:
-    void ResolveSchemaOffsets();
+    class Listener;  // IEntityListener implementation (Entity.cpp)
+
+    void AttachListener();
+    void OnEntityCreated(CEntityInstance* entity);
+    void OnEntityDeleted(CEntityInstance* entity);
+
     void ResolveFinderSignatures();
     CEntityIdentity* GetEntityIdentityByIndex(CGameEntitySystem* pSys, int index);
 
@@ -96,14 +159,15 @@ private:
      */
     CGameEntitySystem* ReadEntitySystemPointer();
 
-    int _offsetPlayerPawn = -1;
-    int _offsetMovementServices = -1;
-    int _offsetButtons = -1;
-    int _offsetButtonStates = -1;
-    bool _schemaOffsetsResolved = false;
     void* _findByClassName = nullptr;
     void* _findByName = nullptr;
     bool _findersResolved = false;
+
+    std::unique_ptr<Listener> _listener;
+    CGameEntitySystem* _listenerSystem = nullptr;  // system the listener is attached to, if any
+    EntityClassIndex _classIndex;
+    Core::CallbackRegistry<EntityCallback> _created{1};
+    Core::CallbackRegistry<EntityCallback> _deleted{2};
 };
 
 }  // namespace CS2Kit::Sdk
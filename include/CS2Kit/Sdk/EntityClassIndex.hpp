@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace CS2Kit::Sdk
+{
+
+/**
+ * @brief Designer name -> dense list of entity indices, kept current from entity
+ * create/delete notifications (see @ref EntitySystem::ForEachByClass).
+ *
+ * Add and Remove are O(1) apart from the class lookup: each class keeps a flat vector, a
+ * removal swaps the last index into the hole, and a per-entity back-pointer finds the
+ * position. A visit costs O(log classes + matches), with no walk of the engine's entity
+ * list and no string compare per entity.
+ *
+ * Patterns are an exact designer name or a prefix ending in `*` (`"weapon_*"`, `"*"`).
+ */
+class EntityClassIndex
+{
+public:
+    /** Record @p entityIndex under @p className. Re-adding an index moves it to the new class. */
+    void Add(int entityIndex, std::string_view className);
+
+    /** Forget @p entityIndex. Unknown indices are ignored. */
+    void Remove(int entityIndex);
+
+    /** Forget everything (map change). */
+    void Clear();
+
+    bool Contains(int entityIndex) const;
+
+    /** Number of entities currently indexed. */
+    size_t Size() const { return _size; }
+
+    /** Number of entities matching @p pattern. */
+    size_t Count(std::string_view pattern) const;
+
+    /**
+     * Call @p fn(entityIndex) for each entity matching @p pattern. Entities added by @p fn
+     * may or may not be visited. If @p fn removes an entity of a class being visited, one
+     * later entity of that class may be skipped.
+     */
+    template <typename Fn>
+    void ForEach(std::string_view pattern, Fn&& fn) const
+    {
+        auto [first, last] = Match(pattern);
+        for (auto it = first; it != last; ++it)
+        {
+            const auto& bucket = it->second;
+            for (size_t i = 0; i < bucket.size(); ++i)
+                fn(bucket[i]);
+        }
+    }
+
+private:
+    using Buckets = std::map<std::string, std::vector<int>, std::less<>>;
+
+    struct Location
+    {
+        std::vector<int>* Bucket = nullptr;  // map nodes are stable, so the pointer outlives inserts
+        uint32_t Position = 0;
+    };
+
+    std::pair<Buckets::const_iterator, Buckets::const_iterator> Match(std::string_view pattern) const;
+
+    Buckets _byClass;
+    std::vector<Location> _where;  // [entity index]
+    size_t _size = 0;
+};
+
+}  // namespace CS2Kit::Sdk
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <CS2Kit/Core/InplaceFunction.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+class CEntityInstance;
+
+namespace CS2Kit::Sdk
+{
+
+class EntityKeyValues;
+
+/** Per-flush entity I/O counters, surfaced in the kit's `entity_io` status section. */
+struct EntityIoCounts
+{
+    uint64_t Spawns = 0;
+    uint64_t Inputs = 0;
+    uint64_t KeyValues = 0;
+    uint64_t Removals = 0;
+    uint64_t Coalesced = 0;  /**< Duplicate inputs/keyvalues folded into an earlier command. */
+    uint64_t Dropped = 0;    /**< Commands whose target was removed in the same frame, or was gone at flush. */
+
+    EntityIoCounts& operator+=(const EntityIoCounts& other)
+    {
+        Spawns += other.Spawns;
+        Inputs += other.Inputs;
+        KeyValues += other.KeyValues;
+        Removals += other.Removals;
+        Coalesced += other.Coalesced;
+        Dropped += other.Dropped;
+        return *this;
+    }
+};
+
+/**
+ * @brief One frame's worth of queued entity commands, coalesced as they arrive.
+ *
+ * Targets are entity handles, not pointers, so a command whose entity the game deletes
+ * before the flush resolves to nothing and is dropped instead of touching freed memory.
+ *
+ * - An input identical to one already queued (same target, input, parameter, activator and
+ *   caller) is folded into it.
+ * - A keyvalue set to a key already queued for the same entity overwrites the queued value.
+ * - Queuing a removal drops every input and keyvalue already queued for that entity, and
+ *   any queued for it later in the frame. A repeated removal is ignored.
+ *
+ * @ref Take hands back the surviving commands, each kind in queue order. The caller then
+ * runs them phase by phase: spawns, keyvalues, inputs, removals.
+ */
+class EntityCommandBuffer
+{
+public:
+    static constexpr uint32_t NoEntity = 0xFFFFFFFFu;
+
+    using SpawnCallback = Core::InplaceFunction<void(CEntityInstance*)>;
+
+    struct Spawn
+    {
+        std::string ClassName;
+        std::shared_ptr<EntityKeyValues> KeyValues;  // shared_ptr: the deleter is bound where the type is complete
+        SpawnCallback OnSpawned;
+    };
+
+    struct Input
+    {
+        uint32_t Target = NoEntity;
+        std::string Name;
+        std::string Param;
+        float Value = 0.0f;
+        bool IsFloat = false;
+        uint32_t Activator = NoEntity;
+        uint32_t Caller = NoEntity;
+    };
+
+    struct KeyValue
+    {
+        uint32_t Target = NoEntity;
+        std::string Key;
+        std::string Value;
+    };
+
+    /** The commands one @ref Take returns, plus what coalescing did to them. */
+    struct Batch
+    {
+        std::vector<Spawn> Spawns;
+        std::vector<KeyValue> KeyValues;
+        std::vector<Input> Inputs;
+        std::vector<uint32_t> Removals;
+        EntityIoCounts Counts;  // Spawns..Removals = sizes above; Coalesced/Dropped = work saved
+    };
+
+    void QueueSpawn(std::string_view className, std::shared_ptr<EntityKeyValues> keyValues,
+                    SpawnCallback onSpawned = {});
+    void QueueInput(Input input);
+    void QueueKeyValue(uint32_t target, std::string_view key, std::string_view value);
+    void QueueRemove(uint32_t target);
+
+    /** Commands waiting for the next @ref Take. */
+    size_t Pending() const;
+
+    /** Hand over every surviving command and start a new frame. */
+    Batch Take();
+
+private:
+    Batch _batch;
+    std::unordered_map<uint32_t, std::vector<uint32_t>> _inputsByTarget;     // target -> indices into Inputs
+    std::unordered_map<uint32_t, std::vector<uint32_t>> _keyValuesByTarget;  // target -> indices into KeyValues
+    std::unordered_set<uint32_t> _removed;
+};
+
+}  // namespace CS2Kit::Sdk
@@ -8,6 +8,8 @@ class Color;
 namespace CS2Kit::Sdk
 {
 
+class EntitySpawnTemplate;
+
 /**
  * @brief Builder for entity spawn keyvalues ("origin", "spawnflags", "effect_name", ...).
  *
@@ -20,6 +22,10 @@ class EntityKeyValues
 {
 public:
     EntityKeyValues();
+
+    /** Start from @p tmpl's keyvalues; later Set calls override them per instance. */
+    explicit EntityKeyValues(const EntitySpawnTemplate& tmpl);
+
     ~EntityKeyValues();
     EntityKeyValues(const EntityKeyValues&) = delete;
     EntityKeyValues& operator=(const EntityKeyValues&) = delete;
@@ -32,6 +38,9 @@ public:
     EntityKeyValues& Set(const char* key, const QAngle& value);
     EntityKeyValues& Set(const char* key, const Color& value);
 
+    /** Copy every keyvalue of @p tmpl into this builder, replacing keys already set. */
+    EntityKeyValues& Apply(const EntitySpawnTemplate& tmpl);
+
     /** The wrapped object; nullptr after Detach(). */
     CEntityKeyValues* Raw() const { return _kv; }
 
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <CS2Kit/Core/Profiler.hpp>
+#include <CS2Kit/Sdk/EntityCommandBuffer.hpp>
+#include <CS2Kit/Sdk/EntityPool.hpp>
+#include <memory>
+
 class CEntityInstance;
 class IRecipientFilter;
 
@@ -17,6 +22,11 @@ class EntityKeyValues;
  * guards on its own resolved pointer and no-ops (or returns nullptr) when the
  * signature is missing, so callers can branch on CanSpawn() for fallbacks but
  * never need to.
+ *
+ * The Queue* variants defer the same operations to the end of the frame (see
+ * @ref FlushQueued). Code that fires many inputs or spawns from callbacks in one frame
+ * (glow pairs, beams, particles on a whole team) should prefer them: duplicates coalesce,
+ * and commands aimed at an entity removed in the same frame are dropped.
  */
 class EntityOpsService
 {
@@ -74,7 +84,56 @@ public:
      *  new value replicates immediately instead of riding the next broadcast. */
     void NotifyFieldChanged(CEntityInstance* entity, const char* className, const char* fieldName);
 
+    using SpawnCallback = EntityCommandBuffer::SpawnCallback;
+
+    /** Deferred Spawn. @p onSpawned receives the new entity, or nullptr if creation failed. */
+    void QueueSpawn(const char* className, std::unique_ptr<EntityKeyValues> kv, SpawnCallback onSpawned = {});
+
+    /** Deferred AcceptInput; an identical input already queued this frame is not repeated. */
+    void QueueInput(CEntityInstance* entity, const char* input, const char* param = nullptr,
+                    CEntityInstance* activator = nullptr, CEntityInstance* caller = nullptr);
+
+    /** Deferred AcceptInputFloat; an identical input already queued this frame is not repeated. */
+    void QueueInputFloat(CEntityInstance* entity, const char* input, float value, CEntityInstance* activator = nullptr,
+                         CEntityInstance* caller = nullptr);
+
+    /** Deferred keyvalue write (an "AddOutput" input of "key value"); the last value queued per key wins. */
+    void QueueKeyValue(CEntityInstance* entity, const char* key, const char* value);
+
+    /** Deferred Remove. Drops the inputs and keyvalues queued for @p entity this frame. */
+    void QueueRemove(CEntityInstance* entity);
+
+    /**
+     * Run everything queued, in this order: spawns, keyvalues, inputs, removals. Each phase
+     * keeps queue order. Called by the kit's OnGameFrame after the scheduler, so callbacks
+     * that queue during the frame see their commands applied the same tick. Commands queued
+     * from a spawn callback run in the next flush.
+     */
+    void FlushQueued() { Flush(/*doSpawn=*/true); }
+
+    /**
+     * The last flush, run by `CS2Kit::Shutdown` while the entity system is still attached: no frame
+     * follows an unload. Removals, keyvalues and inputs go out; queued spawns are dropped (their
+     * callbacks get nullptr), since nothing would be left to own the entities.
+     */
+    void FlushForShutdown() { Flush(/*doSpawn=*/false); }
+
+    /** Commands waiting for the next @ref FlushQueued. */
+    size_t QueuedCount() const { return _queue.Pending(); }
+
+    /** What the most recent flush with work did. */
+    const EntityIoCounts& LastFlushCounts() const { return _lastFlush; }
+
+    /** Sums over every flush since load. */
+    const EntityIoCounts& TotalCounts() const { return _total; }
+
+    /** Spare effect entities parked for reuse instead of being removed and respawned. */
+    EntityPool& Pool() { return _pool; }
+    const EntityPool& Pool() const { return _pool; }
+
 private:
+    void Flush(bool doSpawn);
+
     // Stored untyped so variant_t/CEntityKeyValues/EmitSound_t never leak into
     // this header; EntityOps.cpp bit_casts to file-local typedefs.
     void* _createEntityByName = nullptr;
@@ -85,6 +144,12 @@ private:
     void* _setModel = nullptr;
     void* _emitSoundParams = nullptr;
     void* _emitSoundFilter = nullptr;
+
+    EntityCommandBuffer _queue;
+    EntityPool _pool;
+    EntityIoCounts _lastFlush;
+    EntityIoCounts _total;
+    Core::ProbePoint _flushProbe{"entity_io.flush"};
 };
 
 }  // namespace CS2Kit::Sdk
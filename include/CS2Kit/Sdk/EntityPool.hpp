@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class CEntityInstance;
+
+namespace CS2Kit::Sdk
+{
+
+/**
+ * @brief Parks spare effect entities by kind so the next spawn of that kind reuses one
+ * instead of creating a new entity (`Engine().EntityOps.Pool()`).
+ *
+ * @ref Park detaches the entity from whatever it followed ("ClearParent"), drops its transmit
+ * filter entry, and makes it inert: rendering off (rendermode 10) and glow off (glowstate 0).
+ * It stays invisible without any CheckTransmit filtering, including after the plugin unloads.
+ * @ref Take hands it back as parked. The caller re-parents it, restores rendering and glow, and
+ * re-filters it, e.g. with FollowEntity and TransmitFilterService::SetEntityExclusive.
+ *
+ * The kind string is the caller's contract. Entities parked under one kind must be
+ * interchangeable apart from what the caller resets on reuse (model, parent). Put anything
+ * else that differs, such as a glow color baked in at spawn, into the kind.
+ *
+ * A parked entity the game deletes (round restart cleanup, map change) drops out of the pool
+ * through the entity-deleted listener. Beyond @ref MaxParkedPerKind, Park queues a removal
+ * instead. @ref Shutdown removes whatever is still parked; @ref Clear drops a previous map's entries.
+ */
+class EntityPool
+{
+public:
+    static constexpr size_t MaxParkedPerKind = 64;
+
+    /** Subscribe to entity deletions. Called by EntityOpsService::Initialize. */
+    void Initialize();
+
+    /** Remove every parked entity now. Called by `CS2Kit::Shutdown`; no frame follows to flush a queue. */
+    void Shutdown();
+
+    /**
+     * Forget every parked entry without removing anything. Called on server startup: the map
+     * change already destroyed those entities, and their handles could resolve to new ones.
+     */
+    void Clear();
+
+    /** A parked entity of @p kind, or nullptr when none is left (spawn a fresh one). */
+    CEntityInstance* Take(std::string_view kind);
+
+    /** Park @p entity under @p kind for reuse. The pool owns it from here on. */
+    void Park(std::string_view kind, CEntityInstance* entity);
+
+    /** Entities currently parked, over all kinds. */
+    size_t ParkedCount() const { return _parkedCount; }
+
+    /** Takes served from the pool since load, i.e. spawns avoided. */
+    uint64_t ReuseCount() const { return _reuseCount; }
+
+private:
+    struct Parked
+    {
+        uint32_t Handle;
+        int Index;
+    };
+
+    void OnEntityDeleted(CEntityInstance* entity);
+
+    std::map<std::string, std::vector<Parked>, std::less<>> _byKind;
+    size_t _parkedCount = 0;
+    uint64_t _reuseCount = 0;
+};
+
+}  // namespace CS2Kit::Sdk
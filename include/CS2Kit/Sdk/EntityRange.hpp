@@ -0,0 +1,155 @@
+#pragma once
+
+#include <CS2Kit/Sdk/MemoryAccess.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+
+class CEntityInstance;
+
+namespace CS2Kit::Sdk
+{
+
+/**
+ * @brief Where the fields the iterator reads sit inside one entity identity.
+ * The kit fills it from CEntityIdentity; tests and benchmarks describe a stand-in struct.
+ */
+struct IdentityLayout
+{
+    size_t Stride = 0;       ///< sizeof one identity (chunks are arrays of them)
+    int InstanceOffset = 0;  ///< CEntityInstance* m_pInstance
+    int HandleOffset = 0;    ///< uint32 m_EHandle; low 15 bits = entity index while the slot is live
+    int NameOffset = 0;      ///< CUtlSymbolLarge m_designerName (an interned const char*)
+};
+
+/**
+ * @brief Forward range over live entities, walking identity chunks directly.
+ *
+ * Reads the same chunk table that single-index lookups use (`m_EntityList.m_pIdentityChunks`).
+ * A missing chunk is skipped whole. An identity counts as live when its instance is set and
+ * its handle still carries its own index; a freed slot fails that check. With a designer-name
+ * filter, names are compared by pointer: every entity of a class shares one interned string,
+ * so only identities seen before the first match need a strcmp. After that, a match is one
+ * pointer compare.
+ *
+ * The range reads the chunk table lazily. Do not create or delete entities while iterating,
+ * because a freshly recycled slot may or may not be visited.
+ *
+ * @code
+ * for (CEntityInstance* door : Engine().Entities.Iterate("func_door"))
+ *     ...
+ * @endcode
+ */
+class EntityRange
+{
+public:
+    class Iterator
+    {
+    public:
+        using value_type = CEntityInstance*;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator() = default;
+
+        CEntityInstance* operator*() const { return _current; }
+
+        Iterator& operator++()
+        {
+            Advance();
+            return *this;
+        }
+        void operator++(int) { Advance(); }
+
+        bool operator==(std::default_sentinel_t) const { return _current == nullptr; }
+
+        /** Entity index of the current element. */
+        int Index() const { return _index; }
+
+    private:
+        friend class EntityRange;
+
+        explicit Iterator(const EntityRange* range)
+            : _range(range), _base(range->_chunkCount > 0 ? static_cast<std::byte*>(range->_chunks[0]) : nullptr)
+        {
+            Advance();
+        }
+
+        void Advance()
+        {
+            const auto& r = *_range;
+            const IdentityLayout& layout = r._layout;
+            while (_chunk < r._chunkCount)
+            {
+                if (_base)
+                {
+                    while (++_slot < r._chunkSize)
+                    {
+                        void* identity = _base + static_cast<size_t>(_slot) * layout.Stride;
+                        auto* instance = ReadAt<CEntityInstance*>(identity, layout.InstanceOffset);
+                        if (!instance)
+                            continue;
+                        const int index = _chunk * r._chunkSize + _slot;
+                        if (static_cast<int>(ReadAt<uint32_t>(identity, layout.HandleOffset) & 0x7FFF) != index)
+                            continue;
+                        if (r._designerName && !NameMatches(ReadAt<const char*>(identity, layout.NameOffset)))
+                            continue;
+
+                        _index = index;
+                        _current = instance;
+                        return;
+                    }
+                }
+                // Next chunk; unallocated ones are skipped whole.
+                ++_chunk;
+                _slot = -1;
+                _base = _chunk < r._chunkCount ? static_cast<std::byte*>(r._chunks[_chunk]) : nullptr;
+            }
+            _current = nullptr;
+        }
+
+        bool NameMatches(const char* name)
+        {
+            if (_interned)
+                return name == _interned;
+            if (!name || std::strcmp(name, _range->_designerName) != 0)
+                return false;
+            _interned = name;  // every later entity of this class carries this same pointer
+            return true;
+        }
+
+        const EntityRange* _range = nullptr;
+        std::byte* _base = nullptr;  // current chunk, null when unallocated
+        int _chunk = 0;
+        int _slot = -1;
+        int _index = -1;
+        CEntityInstance* _current = nullptr;
+        const char* _interned = nullptr;
+    };
+
+    /** An empty range (no entity system). */
+    EntityRange() = default;
+
+    /**
+     * @param chunks       Identity chunk table; null entries are unallocated chunks.
+     * @param designerName Exact designer name to keep, or nullptr for every entity.
+     */
+    EntityRange(void* const* chunks, int chunkCount, int chunkSize, const IdentityLayout& layout,
+                const char* designerName = nullptr)
+        : _chunks(chunks), _chunkCount(chunks ? chunkCount : 0), _chunkSize(chunkSize), _layout(layout),
+          _designerName(designerName)
+    {
+    }
+
+    Iterator begin() const { return Iterator(this); }
+    std::default_sentinel_t end() const { return {}; }
+
+private:
+    void* const* _chunks = nullptr;
+    int _chunkCount = 0;
+    int _chunkSize = 1;
+    IdentityLayout _layout;
+    const char* _designerName = nullptr;
+};
+
+}  // namespace CS2Kit::Sdk
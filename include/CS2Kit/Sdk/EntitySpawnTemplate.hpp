@@ -0,0 +1,80 @@
+#pragma once
+
+#include <CS2Kit/Sdk/Vec3.hpp>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace CS2Kit::Sdk
+{
+
+/**
+ * @brief A classname plus spawn keyvalues, built once and stamped into an @ref EntityKeyValues
+ * per spawn.
+ *
+ * Effects that spawn the same kind of entity over and over should keep their fixed keyvalues
+ * here, typically in a function-local static. Each spawn then only sets what differs:
+ *
+ * @code
+ * static const EntitySpawnTemplate relay = EntitySpawnTemplate("prop_dynamic").Set("spawnflags", 256);
+ * EntityKeyValues kv(relay);
+ * kv.Set("model", model.c_str());
+ * ops.Spawn(relay.ClassName().c_str(), kv);
+ * @endcode
+ *
+ * Setting a key twice replaces the earlier value in place, so a template never replays
+ * duplicate keys. The template is plain data with no engine types, so it is safe to build
+ * before the game is up.
+ */
+class EntitySpawnTemplate
+{
+public:
+    enum class ValueKind : uint8_t
+    {
+        String,
+        Int,
+        Float,
+        Bool,
+        Vector,
+        Angles,
+        Color
+    };
+
+    struct Entry
+    {
+        std::string Key;
+        ValueKind Kind = ValueKind::String;
+        std::string Text;                // String
+        int Int = 0;                     // Int, Bool
+        float Float = 0.0f;              // Float
+        Vec3 Vector;                     // Vector, Angles (pitch, yaw, roll)
+        std::array<uint8_t, 4> Color{};  // Color (r, g, b, a)
+    };
+
+    explicit EntitySpawnTemplate(std::string className) : _className(std::move(className)) {}
+
+    EntitySpawnTemplate& Set(std::string_view key, const char* value);
+    EntitySpawnTemplate& Set(std::string_view key, int value);
+    EntitySpawnTemplate& Set(std::string_view key, float value);
+    EntitySpawnTemplate& Set(std::string_view key, bool value);
+    EntitySpawnTemplate& SetVector(std::string_view key, const Vec3& value);
+    EntitySpawnTemplate& SetAngles(std::string_view key, const Vec3& value);
+    EntitySpawnTemplate& SetColor(std::string_view key, uint8_t r, uint8_t g, uint8_t b, uint8_t a = 255);
+
+    const std::string& ClassName() const { return _className; }
+    const std::vector<Entry>& Entries() const { return _entries; }
+
+    /** The entry for @p key, or nullptr. */
+    const Entry* Find(std::string_view key) const;
+
+private:
+    Entry& Slot(std::string_view key, ValueKind kind);
+
+    std::string _className;
+    std::vector<Entry> _entries;
+};
+
+}  // namespace CS2Kit::Sdk
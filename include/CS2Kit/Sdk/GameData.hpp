@@ -6,13 +6,16 @@
 namespace CS2Kit::Sdk
 {
 
+class OffsetCache;
+
 /**
  * @brief Centralized gamedata manager for platform-specific signatures and offsets.
  *
  * Loads byte-pattern signatures and named integer offsets from a JSON file.
- * ResolveAll() eagerly scans every signature once (CS2Kit::Initialize runs it as
- * the GameData load stage); FindSignature/ResolveSignature then answer from the
- * cache, and per-entry failures/ambiguities are reported by name.
+ * ResolveAll() eagerly resolves every signature (CS2Kit::Initialize runs it as
+ * the GameData load stage), walking each library once for all of its patterns;
+ * FindSignature/ResolveSignature then answer from the cache, and per-entry
+ * failures/ambiguities are reported by name.
  */
 class GameData
 {
@@ -22,6 +25,7 @@ public:
         void* Match = nullptr;     ///< Raw pattern-match address.
         void* Resolved = nullptr;  ///< Match after rel32 resolution (== Match when offset is 0).
         bool Unique = true;        ///< False when the pattern matched more than once.
+        bool FromCache = false;    ///< Taken from the OffsetCache (pattern re-verified) instead of scanned.
         std::string Error;         ///< Empty when resolved.
     };
 
@@ -32,8 +36,17 @@ public:
     void* FindSignature(const std::string& name) const;
     void* ResolveSignature(const std::string& name) const;
 
-    /** @brief Eagerly resolve every signature into the cache. */
-    void ResolveAll();
+    /**
+     * @brief Eagerly resolve every signature into the cache.
+     *
+     * Signatures are grouped by library and each library is scanned in a single pass
+     * (FindPatternsEx). With @p offsets, a signature whose cached address still matches its
+     * pattern stays out of the scan; fresh unique matches are stored back for the next load.
+     */
+    void ResolveAll(OffsetCache* offsets = nullptr);
+
+    /** Signatures the last ResolveAll took from the OffsetCache rather than scanning for. */
+    size_t CachedCount() const;
 
     /** @brief "N/M signatures failed: a, b; ambiguous: c" - empty when all resolved uniquely. */
     std::string FailureSummary() const;
@@ -3,9 +3,12 @@
 #include <igameevents.h>
 
 #include <CS2Kit/Core/CallbackRegistry.hpp>
+#include <CS2Kit/Core/InplaceFunction.hpp>
+#include <CS2Kit/Core/Profiler.hpp>
+#include <concepts>
 #include <cstdint>
-#include <functional>
 #include <set>
+#include <source_location>
 #include <string>
 
 namespace CS2Kit::Sdk
@@ -25,19 +28,26 @@ public:
     bool FireEvent(IGameEvent* event, bool dontBroadcast = false);
     void FreeEvent(IGameEvent* event);
 
-    using EventCallback = std::function<void(IGameEvent*)>;
-    uint64_t Listen(const char* eventName, EventCallback callback);
+    using EventCallback = Core::InplaceFunction<void(IGameEvent*)>;
+    /** @p site names the listener in the profiler; leave it defaulted. */
+    uint64_t Listen(const char* eventName, EventCallback callback,
+                    std::source_location site = std::source_location::current());
 
     /** Typed listen: @p TEvent is one of @ref CS2Kit::Sdk::Events (carries Name + From).
      *  The handler receives the decoded struct; the raw-IGameEvent overload above stays as
-     *  the escape hatch for unmodeled events. */
-    template <class TEvent>
-    uint64_t Listen(std::function<void(const TEvent&)> handler)
+     *  the escape hatch for unmodeled events. The handler is captured as-is (no std::function
+     *  wrapper), so a small closure stays inline in the stored EventCallback. */
+    template <class TEvent, class Handler>
+        requires std::invocable<Handler&, const TEvent&>
+    uint64_t Listen(Handler handler, std::source_location site = std::source_location::current())
     {
-        return Listen(TEvent::Name, [h = std::move(handler)](IGameEvent* e) {
-            if (e)
-                h(TEvent::From(*e));
-        });
+        return Listen(
+            TEvent::Name,
+            [h = std::move(handler)](IGameEvent* e) {
+                if (e)
+                    h(TEvent::From(*e));
+            },
+            site);
     }
 
     void RemoveListener(uint64_t id);
@@ -64,6 +74,8 @@ private:
     {
         std::string EventName;
         EventCallback Callback;
+        std::source_location Site;
+        Core::ProbeId Probe = 0;  // resolved the first time it fires with the profiler on
     };
 
     Core::CallbackRegistry<RegisteredListener> _listeners;
@@ -18,6 +18,8 @@ namespace CS2Kit::Sdk
  * a glow prop parented to it (the indirection renders only the outline) - both transmit-filtered
  * to the beneficiary alone. Call @ref Reconcile on a repeating tick (see @ref ReconcileIntervalMs)
  * to track spawns, deaths, team/model changes, and round restarts; call @ref Destroy to tear down.
+ * A torn-down pair is parked in the EntityOps @ref EntityPool, and the next pair takes it back
+ * (re-modeled) instead of spawning two new props.
  */
 class GlowVision
 {
@@ -54,6 +56,7 @@ private:
         int GlowIndex = -1;
         int Team = 0;
         std::string Model;
+        std::string GlowKind;  // EntityPool kind the glow clone parks under
 
         // The relay handle is the single source of truth for liveness; DestroyPair resets it.
         bool Active() const { return RelayHandle != InvalidHandle; }
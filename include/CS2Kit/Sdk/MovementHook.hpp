@@ -1,13 +1,58 @@
 #pragma once
 
 #include <CS2Kit/Core/CallbackRegistry.hpp>
+#include <CS2Kit/Core/InplaceFunction.hpp>
+#include <CS2Kit/Core/Profiler.hpp>
+#include <CS2Kit/Core/Slot.hpp>
 #include <CS2Kit/Sdk/UserCmd.hpp>
+#include <algorithm>
+#include <array>
 #include <cstdint>
-#include <functional>
 
 namespace CS2Kit::Sdk
 {
 
+/**
+ * @brief Movement-services pointer -> slot table behind @ref MovementHook::SlotFromMovementServices.
+ *
+ * Filled once per frame from a per-slot source (the kit passes @ref PlayerSnapshot's column),
+ * then every lookup that frame is a scan of 64 pointers. A miss costs the same and does not
+ * refill, so an unknown pointer cannot trigger a rebuild per RunCommand; a pawn spawned since
+ * the fill is found from the next frame on.
+ */
+class MovementSlotIndex
+{
+public:
+    /** Slot of @p services, or -1. Calls @p servicesOf(slot) for every slot when @p frame is new. */
+    template <class ServicesOf>
+    int Find(const void* services, uint64_t frame, ServicesOf&& servicesOf)
+    {
+        if (!services)
+            return -1;
+        if (frame != _frame)
+        {
+            for (int slot = 0; slot < Core::MaxPlayers; ++slot)
+                _services[slot] = servicesOf(slot);
+            _frame = frame;
+        }
+        auto it = std::find(_services.begin(), _services.end(), services);
+        return it != _services.end() ? static_cast<int>(it - _services.begin()) : -1;
+    }
+
+    /** Forget the table; the next Find refills it whatever its frame. */
+    void Clear()
+    {
+        _services.fill(nullptr);
+        _frame = NoFrame;
+    }
+
+private:
+    static constexpr uint64_t NoFrame = ~uint64_t{0};
+
+    std::array<const void*, Core::MaxPlayers> _services{};
+    uint64_t _frame = NoFrame;
+};
+
 /**
  * @brief Manual vtable hook on CPlayer_MovementServices::RunCommand - the per-tick,
  * per-player movement entry point (gamedata offset "RunCommand").
@@ -37,9 +82,9 @@ namespace CS2Kit::Sdk
 class MovementHook
 {
 public:
-    using Callback = std::function<void(int slot)>;
-    using CmdCallback = std::function<void(int slot, const UserCmdView& cmd)>;
-    using CmdFilter = std::function<void(int slot, UserCmdView& cmd)>;
+    using Callback = Core::InplaceFunction<void(int slot)>;
+    using CmdCallback = Core::InplaceFunction<void(int slot, const UserCmdView& cmd)>;
+    using CmdFilter = Core::InplaceFunction<void(int slot, UserCmdView& cmd)>;
 
     MovementHook() = default;
     ~MovementHook() { Remove(); }
@@ -51,16 +96,20 @@ public:
     bool Installed() const { return _installed; }
     void Remove();
 
-    uint64_t ListenPre(Callback callback) { return _pre.Add(std::move(callback), _nextId++); }
-    uint64_t ListenPost(Callback callback) { return _post.Add(std::move(callback), _nextId++); }
-    uint64_t ListenPreCmd(CmdCallback callback) { return _preCmd.Add(std::move(callback), _nextId++); }
-    uint64_t ListenPostCmd(CmdCallback callback) { return _postCmd.Add(std::move(callback), _nextId++); }
+    uint64_t ListenPre(Callback callback) { return _pre.Add(std::move(callback)); }
+    uint64_t ListenPost(Callback callback) { return _post.Add(std::move(callback)); }
+    uint64_t ListenPreCmd(CmdCallback callback) { return _preCmd.Add(std::move(callback)); }
+    uint64_t ListenPostCmd(CmdCallback callback) { return _postCmd.Add(std::move(callback)); }
 
     /** Mutable pre-decode-time edit of the shared UserCmdView; see the class docs. */
-    uint64_t ListenFilterCmd(CmdFilter filter) { return _filter.Add(std::move(filter), _nextId++); }
+    uint64_t ListenFilterCmd(CmdFilter filter) { return _filter.Add(std::move(filter)); }
     void RemoveListener(uint64_t id);
 
-    /** Slot whose pawn owns @p movementServices, or -1. */
+    /**
+     * Slot whose possessed pawn owns @p movementServices, or -1. Looked up in a table taken
+     * from the frame's @ref PlayerSnapshot, so it is a scan of 64 pointers and never a rebuild
+     * (see @ref MovementSlotIndex).
+     */
     int SlotFromMovementServices(void* movementServices) const;
 
 private:
@@ -68,17 +117,20 @@ private:
     void* Hook_RunCommandPost(void* userCmd);
     void DecodeUserCmd(void* userCmd);
 
-    Core::CallbackRegistry<Callback> _pre;
-    Core::CallbackRegistry<Callback> _post;
-    Core::CallbackRegistry<CmdCallback> _preCmd;
-    Core::CallbackRegistry<CmdCallback> _postCmd;
-    Core::CallbackRegistry<CmdFilter> _filter;
-    uint64_t _nextId = 1;  // one handle space across all five registries, so RemoveListener is unambiguous
+    // Distinct handle spaces across all five registries, so RemoveListener is unambiguous.
+    Core::CallbackRegistry<Callback> _pre{1};
+    Core::CallbackRegistry<Callback> _post{2};
+    Core::CallbackRegistry<CmdCallback> _preCmd{3};
+    Core::CallbackRegistry<CmdCallback> _postCmd{4};
+    Core::CallbackRegistry<CmdFilter> _filter{5};
     UserCmdView _cmdView;  // decoded once per RunCommand, reused across pre/post dispatch
     int _pbOffset = -1;    // gamedata "UserCmdPB"; negative disables decoding
     bool _installed = false;
     void* _vtable = nullptr;  // vtable of the hooked instance; see Remove()
     int _preSlot = -1;        // slot resolved in the pre hook, reused by the immediately-following post
+    mutable MovementSlotIndex _slotIndex;  // refilled once per snapshot frame
+    Core::ProbePoint _preProbe{"movement.pre"};
+    Core::ProbePoint _postProbe{"movement.post"};
 };
 
 }  // namespace CS2Kit::Sdk
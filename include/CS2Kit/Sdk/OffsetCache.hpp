@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace CS2Kit::Sdk
+{
+
+/**
+ * @brief On-disk cache of signature matches and schema field offsets, keyed by module build.
+ *
+ * Scanning every gamedata signature and walking schema class fields is what dominates a cold
+ * load. Both results are fixed for a given build of the game libraries, so the cache stores
+ * them next to each module's build id (see @ref IdentifyModule): signature matches as RVAs
+ * from the module base, schema fields as offset + size. On load, entries whose module build
+ * changed are dropped and rediscovered the slow way, so a game update falls back transparently.
+ *
+ * Callers still check what they take from it. @ref GameData re-checks the pattern bytes at a
+ * cached address before using it. Schema fields are only range-checked: Load drops negative
+ * entries, and the schema service rereads a field whose cached extent falls outside its class.
+ * A hand-edited offset that stays inside the class is trusted, so delete the file rather than
+ * edit it. Game-thread only.
+ */
+class OffsetCache
+{
+public:
+    struct Field
+    {
+        int Offset = -1;
+        int Size = 0;  // 0 when the engine reported no size
+    };
+
+    /** Current build id of a module by short name ("server"); empty when it is not loaded. */
+    using ModuleIdentifier = std::function<std::string(std::string_view module)>;
+
+    static constexpr int FormatVersion = 1;
+    /** Schema offsets come from the server library, so they are filed under its build. */
+    static constexpr std::string_view SchemaModule = "server";
+
+    /** @p identify defaults to @ref IdentifyModule; tests inject fixed ids. */
+    explicit OffsetCache(ModuleIdentifier identify = {});
+
+    /**
+     * @brief Read @p path, keeping only entries for modules whose build id still matches.
+     * A missing, unreadable or other-version file leaves the cache empty (false).
+     */
+    bool Load(const std::filesystem::path& path);
+
+    /** Write the cache to @p path if anything changed since it was loaded or last saved. */
+    bool Save(const std::filesystem::path& path);
+
+    std::optional<uint64_t> FindSignature(std::string_view module, std::string_view name) const;
+    void StoreSignature(std::string_view module, std::string_view name, uint64_t rva);
+    /** Drop a signature whose cached address no longer verifies. */
+    void ForgetSignature(std::string_view module, std::string_view name);
+
+    std::optional<Field> FindField(std::string_view className, std::string_view fieldName) const;
+    void StoreField(std::string_view className, std::string_view fieldName, Field field);
+    /** Drop a field whose cached offset failed its range check. */
+    void ForgetField(std::string_view className, std::string_view fieldName);
+
+    bool Dirty() const { return _dirty; }
+    size_t SignatureCount() const;
+    size_t FieldCount() const { return _fields.size(); }
+    /** Modules whose stored entries were discarded by the last @ref Load (build changed). */
+    size_t StaleModules() const { return _staleModules; }
+
+private:
+    struct ModuleEntries
+    {
+        std::string BuildId;
+        std::map<std::string, uint64_t, std::less<>> Signatures;  // name -> RVA
+    };
+
+    const std::string& BuildIdOf(std::string_view module);
+    static std::string FieldKey(std::string_view className, std::string_view fieldName);
+
+    ModuleIdentifier _identify;
+    std::map<std::string, ModuleEntries, std::less<>> _modules;
+    std::map<std::string, Field, std::less<>> _fields;  // "Class::field", valid for SchemaModule's build
+    bool _dirty = false;
+    size_t _staleModules = 0;
+};
+
+}  // namespace CS2Kit::Sdk
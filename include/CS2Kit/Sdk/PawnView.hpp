@@ -0,0 +1,114 @@
+#pragma once
+
+#include <CS2Kit/Sdk/MoveType.hpp>
+#include <CS2Kit/Sdk/PlayerController.hpp>
+#include <CS2Kit/Sdk/SchemaField.hpp>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+class CEntityInstance;
+class Vector;
+class QAngle;
+
+namespace CS2Kit::Sdk
+{
+
+/**
+ * @brief A player's pawn and its scene node, resolved once for a run of reads.
+ *
+ * Each @ref PlayerController getter resolves `m_hPlayerPawn` again, so code that reads
+ * several pawn fields pays for the handle lookup each time. A PawnView does it once on
+ * construction (plus the body component -> scene node hop), and every read after that is
+ * a cached offset plus this base pointer. The view is meant to live for one block of code,
+ * like a PlayerController. Do not keep it across frames, because the pawn can be freed.
+ *
+ * Besides the typed getters, any @ref SchemaField of the pawn can be read with `Get<Field>()`.
+ * Fields of `CGameSceneNode` / `CSkeletonInstance` read from the scene node instead. To read
+ * several at once into a plain struct, use `ReadFields`:
+ *
+ * @code
+ * using Health = Sdk::SchemaField<"CBaseEntity", "m_iHealth", int>;
+ * using Armor = Sdk::SchemaField<"CCSPlayerPawn", "m_ArmorValue", int>;
+ *
+ * struct Vitals { int Health; int Armor; };
+ * Sdk::PawnView pawn(slot);
+ * auto vitals = pawn.ReadFields<Vitals, Health, Armor>();  // Vitals{Health, Armor}, one pawn resolve
+ * @endcode
+ */
+class PawnView
+{
+public:
+    /** The pawn of the player in @p slot (m_hPlayerPawn). */
+    explicit PawnView(int slot);
+
+    /** The pawn of @p controller, without looking the controller up again. */
+    explicit PawnView(const PlayerController& controller);
+
+    /** An already-resolved pawn entity (e.g. from `Engine().Snapshot.Pawn(slot)`); may be null. */
+    explicit PawnView(CEntityInstance* pawn);
+
+    bool IsValid() const { return _pawn != nullptr; }
+    CEntityInstance* GetPawn() const { return _pawn; }
+    void* GetSceneNode() const { return _sceneNode; }
+
+    /** @p Field's value on the pawn (or its scene node), or @p fallback when there is no pawn. */
+    template <typename Field>
+    typename Field::Type Get(typename Field::Type fallback = {}) const
+    {
+        return Field::Get(BaseFor<Field>(), fallback);
+    }
+
+    /** Write @p Field. No-op when there is no pawn or the field is unresolved. */
+    template <typename Field>
+    void Set(const typename Field::Type& value) const
+    {
+        Field::Set(BaseFor<Field>(), value);
+    }
+
+    /** Read each of @p Fields in order and aggregate-initialize an @p Out from the values. */
+    template <typename Out, typename... Fields>
+    Out ReadFields() const
+    {
+        return Out{Get<Fields>()...};
+    }
+
+    int GetHealth() const;
+    int GetTeam() const;
+    int GetLifeState() const;
+    bool IsAlive() const;
+    int GetArmor() const;
+    uint32_t GetFlags() const;
+    MoveType GetMoveType() const;
+    Vector GetVelocity() const;
+    Vector GetAbsOrigin() const;
+    QAngle GetAbsAngles() const;
+    QAngle GetEyeAngles() const;
+
+    /** Abs origin plus `m_vecViewOffset` - where shots originate. */
+    Vector GetEyePosition() const;
+
+    float GetFlashDuration() const;
+    float GetFlashMaxAlpha() const;
+
+    /** Current model path from the scene node's CModelState. Empty if unavailable. */
+    std::string GetModelName() const;
+
+private:
+    template <typename Field>
+    void* BaseFor() const
+    {
+        constexpr std::string_view className = Field::Class();
+        if constexpr (className == "CGameSceneNode" || className == "CSkeletonInstance")
+            return _sceneNode;
+        else
+            return _pawn;
+    }
+
+    void ResolveSceneNode();
+
+    CEntityInstance* _pawn = nullptr;
+    void* _sceneNode = nullptr;
+};
+
+}  // namespace CS2Kit::Sdk
@@ -3,6 +3,7 @@
 #include <CS2Kit/Sdk/MemoryAccess.hpp>
 #include <CS2Kit/Sdk/MoveType.hpp>
 #include <CS2Kit/Sdk/ObserverMode.hpp>
+#include <CS2Kit/Sdk/SchemaField.hpp>
 #include <cstdint>
 #include <string>
 
@@ -30,15 +31,15 @@ public:
 
     void Kick(const char* reason) const;
 
-    // Raw schema-field access (escape hatch). Header-only so any field type works without
-    // editing this file; the offset lookup is delegated to SchemaOffset() to keep the internal
-    // SchemaService out of this public header.
+    // Raw schema-field access by run-time name (escape hatch). Header-only so any field type
+    // works without editing this file. Each call looks the offset up by string; for fields read
+    // every tick, a @ref SchemaField alias resolves once and is a plain load after that.
     template <typename T>
     T GetField(const char* className, const char* fieldName) const
     {
         if (!_controller)
             return T{};
-        int offset = SchemaOffset(className, fieldName, sizeof(T));
+        int offset = ResolveSchemaOffset(className, fieldName, sizeof(T));
         if (offset < 0)
             return T{};
         return ReadAt<T>(_controller, offset);
@@ -50,7 +51,7 @@ public:
         auto* pawn = GetPawn();
         if (!pawn)
             return T{};
-        int offset = SchemaOffset(className, fieldName, sizeof(T));
+        int offset = ResolveSchemaOffset(className, fieldName, sizeof(T));
         if (offset < 0)
             return T{};
         return ReadAt<T>(pawn, offset);
@@ -61,7 +62,7 @@ public:
     {
         if (!_controller)
             return;
-        int offset = SchemaOffset(className, fieldName, sizeof(T));
+        int offset = ResolveSchemaOffset(className, fieldName, sizeof(T));
         if (offset < 0)
             return;
         WriteAt<T>(_controller, offset, value);
@@ -73,7 +74,7 @@ public:
         auto* pawn = GetPawn();
         if (!pawn)
             return;
-        int offset = SchemaOffset(className, fieldName, sizeof(T));
+        int offset = ResolveSchemaOffset(className, fieldName, sizeof(T));
         if (offset < 0)
             return;
         WriteAt<T>(pawn, offset, value);
@@ -169,10 +170,6 @@ public:
     void Teleport(const Vector* origin, const QAngle* angles, const Vector* velocity) const;
 
 private:
-    /** Resolve a schema field offset (delegates to the internal SchemaService). */
-    // expectedSize > 0 validates the engine's field size on first lookup (warns on schema drift).
-    int SchemaOffset(const char* className, const char* fieldName, int expectedSize = 0) const;
-
     int _slot;
     CEntityInstance* _controller = nullptr;
 };
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <CS2Kit/Core/Profiler.hpp>
+#include <CS2Kit/Core/Slot.hpp>
+#include <CS2Kit/Sdk/Vec3.hpp>
+#include <array>
+#include <cstdint>
+
+class CEntityInstance;
+
+namespace CS2Kit::Sdk
+{
+
+/**
+ * @brief Per-tick table of every player slot's hot state, captured once per GameFrame.
+ *
+ * Each column is a flat array indexed by slot, filled by one pass over the 64 controllers
+ * at the start of the kit's frame. Readers that touch many slots (target resolution, menu
+ * input, glow reconciliation, CheckTransmit) read plain loads instead of re-resolving the
+ * controller, its pawn handle and every schema field per call.
+ *
+ * Writes made through @ref PlayerController (health, team, teleport, respawn, ...) mark
+ * the slot stale; the next read of that slot re-captures it, so a value written this frame
+ * reads back this frame. State the game changes on its own (damage, movement, deaths) is
+ * as of the frame's capture.
+ *
+ * The pointers are only good within the frame that captured them. Code that runs elsewhere,
+ * such as CheckTransmit, should re-resolve the handle columns instead. A map change marks
+ * every slot stale.
+ */
+class PlayerSnapshot
+{
+public:
+    /** Re-read every slot. Called by the kit's OnGameFrame before any frame callback runs. */
+    void Capture();
+
+    /** Mark one slot stale; its next read re-captures it. Invalid slots are ignored. */
+    void Invalidate(int slot)
+    {
+        if (Core::IsValidSlot(slot))
+            _stale |= uint64_t{1} << slot;
+    }
+
+    /** Mark every slot stale, e.g. after bulk writes that bypass @ref PlayerController. */
+    void InvalidateAll() { _stale = ~uint64_t{0}; }
+
+    /** Number of Capture() passes so far; lets callers tell whether two reads share a frame. */
+    uint64_t Frame() const { return _frame; }
+
+    /** The slot's CCSPlayerController, or nullptr for an empty slot. */
+    CEntityInstance* Controller(int slot) { return Read(_controller, slot); }
+
+    /** The player's own pawn (m_hPlayerPawn), or nullptr. */
+    CEntityInstance* Pawn(int slot) { return Read(_pawn, slot); }
+
+    /** Raw m_hPlayerPawn handle (INVALID_EHANDLE_INDEX when none). */
+    uint32_t PawnHandle(int slot) { return Read(_pawnHandle, slot, 0xFFFFFFFFu); }
+
+    /** The possessed pawn (m_hPawn) - the observer pawn while dead or spectating. */
+    CEntityInstance* CurrentPawn(int slot) { return Read(_currentPawn, slot); }
+
+    /** Raw m_hPawn handle, for readers outside the frame that must re-resolve it. */
+    uint32_t CurrentPawnHandle(int slot) { return Read(_currentPawnHandle, slot, 0xFFFFFFFFu); }
+
+    int Team(int slot) { return Read(_team, slot); }
+    bool Alive(int slot) { return Read(_alive, slot); }
+    int Health(int slot) { return Read(_health, slot); }
+
+    /** Pawn origin (scene node m_vecAbsOrigin); zero when there is no pawn. */
+    Vec3 Origin(int slot) { return Read(_origin, slot); }
+
+    /** Pawn eye angles (pitch, yaw, roll); zero when there is no pawn. */
+    Vec3 EyeAngles(int slot) { return Read(_eyeAngles, slot); }
+
+    /** Held buttons (InputBitMask_t) of the possessed pawn, as @ref EntitySystem::GetPlayerButtons. */
+    uint64_t Buttons(int slot) { return Read(_buttons, slot); }
+
+    /** The possessed pawn's CPlayer_MovementServices, or nullptr. */
+    void* MovementServices(int slot) { return Read(_movementServices, slot); }
+
+    /** The possessed pawn's CPlayer_ObserverServices, or nullptr. */
+    void* ObserverServices(int slot) { return Read(_observerServices, slot); }
+
+private:
+    template <typename T>
+    using Column = std::array<T, Core::MaxPlayers>;
+
+    template <typename T>
+    T Read(const Column<T>& column, int slot, T fallback = T{})
+    {
+        if (!Core::IsValidSlot(slot))
+            return fallback;
+        if (_stale & (uint64_t{1} << slot))
+            CaptureSlot(slot);
+        return column[slot];
+    }
+
+    void CaptureSlot(int slot);
+
+    Column<CEntityInstance*> _controller{};
+    Column<CEntityInstance*> _pawn{};
+    Column<CEntityInstance*> _currentPawn{};
+    Column<uint32_t> _pawnHandle{};
+    Column<uint32_t> _currentPawnHandle{};
+    Column<int> _team{};
+    Column<bool> _alive{};
+    Column<int> _health{};
+    Column<Vec3> _origin{};
+    Column<Vec3> _eyeAngles{};
+    Column<uint64_t> _buttons{};
+    Column<void*> _movementServices{};
+    Column<void*> _observerServices{};
+    uint64_t _stale = ~uint64_t{0}; /**< Bit per slot; reads before the first Capture() capture lazily. */
+    uint64_t _frame = 0;
+    Core::ProbePoint _probe{"snapshot.capture"};
+};
+
+}  // namespace CS2Kit::Sdk
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <CS2Kit/Core/Registry.hpp>
+#include <CS2Kit/Sdk/MemoryAccess.hpp>
+#include <CS2Kit/Utils/FixedString.hpp>
+#include <climits>
+
+namespace CS2Kit::Sdk
+{
+
+/**
+ * @brief Look up a schema field offset (delegates to the internal SchemaService; -1 if
+ * unavailable). When @p expectedSize > 0 the first lookup warns if the engine's field size
+ * differs. Backs @ref SchemaField; call it directly only for names known at run time.
+ */
+int ResolveSchemaOffset(const char* className, const char* fieldName, int expectedSize = 0);
+
+/**
+ * @brief One @ref SchemaField instantiation, as registered in `Core::Registry<SchemaFieldDecl>`.
+ * Load walks these to resolve every declared field up front (the "SchemaFields" stage).
+ */
+struct SchemaFieldDecl
+{
+    const char* ClassName;
+    const char* FieldName;
+    int ExpectedSize;  ///< 0 = no size check
+    int* Slot;         ///< The instantiation's cached offset; the prewarm writes it here (-1 = not in the schema).
+};
+
+/**
+ * @brief Compile-time handle to one schema field: `SchemaField<"CBaseEntity", "m_iHealth", int>`.
+ *
+ * Each instantiation resolves its offset once, on first use, into its own static slot, and
+ * checks the engine's field size against `sizeof(T)` while doing so. After that a read or
+ * write is the cached offset plus the base pointer - no string keys, no map lookups, no
+ * allocation. A lazy lookup that fails (schema system not up yet) is not cached, so it is
+ * retried on the next use. A field the load-time prewarm could not find in the schema (renamed
+ * by a game update) is marked missing for good: reads fall back without another lookup, and
+ * the load report is the only place it is reported.
+ *
+ * @p ExpectedSize defaults to `sizeof(T)`; pass 0 when `T` only views part of the field (an
+ * embedded struct reached through `Ptr`, a vector read through a header view).
+ *
+ * Every instantiation registers itself at static init, so CS2Kit::Initialize resolves all of
+ * them in one pass per class and reports missing or drifted fields together; the first use
+ * mid-round then finds its offset already in place.
+ *
+ * Offsets are fixed by the loaded server binary, so caching for the life of the plugin is safe.
+ * Game-thread only, like the schema system behind it.
+ *
+ * @code
+ * using Health = Sdk::SchemaField<"CBaseEntity", "m_iHealth", int>;
+ * int hp = Health::Get(pawn);
+ * Health::Set(pawn, hp + 10);
+ * @endcode
+ */
+template <Utils::FixedString ClassName, Utils::FixedString FieldName, typename T,
+          int ExpectedSize = static_cast<int>(sizeof(T))>
+class SchemaField
+{
+public:
+    using Type = T;
+
+    /** Byte offset of the field, or -1 when it cannot be resolved. Only an unresolved slot looks it up. */
+    static int Offset()
+    {
+        if (_offset == Unresolved) [[unlikely]]
+            return Resolve();
+        return _offset;
+    }
+
+    /** Pointer to the field inside @p base; null if @p base is null or the field is unresolved. */
+    static T* Ptr(void* base)
+    {
+        if (!base)
+            return nullptr;
+        const int offset = Offset();
+        return offset < 0 ? nullptr : MemberPtr<T>(base, offset);
+    }
+
+    /** The field's value on @p base, or @p fallback if @p base is null or the field is unresolved. */
+    static T Get(void* base, T fallback = T{})
+    {
+        const T* field = Ptr(base);
+        return field ? *field : fallback;
+    }
+
+    /** Write @p value into @p base. No-op if @p base is null or the field is unresolved. */
+    static void Set(void* base, const T& value)
+    {
+        if (T* field = Ptr(base))
+            *field = value;
+    }
+
+    static constexpr const char* Class() { return ClassName.CStr(); }
+    static constexpr const char* Name() { return FieldName.CStr(); }
+
+private:
+    static constexpr int Unresolved = INT_MIN;
+
+    static int Resolve()
+    {
+        (void)_registered;  // odr-use, so every instantiation that is ever read gets registered
+        const int offset = ResolveSchemaOffset(ClassName.CStr(), FieldName.CStr(), ExpectedSize);
+        if (offset >= 0)
+            _offset = offset;
+        return offset;
+    }
+
+    static inline int _offset = Unresolved;
+    static inline const bool _registered = Core::Registry<SchemaFieldDecl>::Add(
+        {ClassName.CStr(), FieldName.CStr(), ExpectedSize, &_offset});
+};
+
+}  // namespace CS2Kit::Sdk
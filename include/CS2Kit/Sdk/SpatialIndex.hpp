@@ -0,0 +1,153 @@
+#pragma once
+
+#include <CS2Kit/Sdk/Vec3.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace CS2Kit::Sdk
+{
+
+/** One query result: the point's id and its squared distance to the query center. */
+struct SpatialHit
+{
+    int Id = -1;
+    float DistanceSq = 0.0f;
+};
+
+/**
+ * @brief Uniform-grid index of id -> position for radius, box and k-nearest queries.
+ *
+ * The grid hashes x/y only, into square columns @p cellSize units wide. CS2 maps are wide
+ * rather than tall, so z is just part of each distance test. Positions live in flat x/y/z
+ * arrays. A query gathers the candidates from the cells it overlaps into a contiguous
+ * scratch block and runs one distance loop over it; that loop has no branches or aliasing,
+ * so the compiler emits SIMD code for it. If a query overlaps more cells than are occupied,
+ * it scans every point instead.
+ *
+ * @ref Upsert is incremental: a point that stays in its cell only has its coordinates
+ * rewritten, so re-feeding every position each frame costs little.
+ *
+ * Ids are small non-negative integers (the kit uses player slots plus offset entity indices,
+ * see @ref SpatialService). Results are appended to the caller's vector, so one buffer can
+ * be reused across queries without allocating.
+ */
+class SpatialIndex
+{
+public:
+    explicit SpatialIndex(float cellSize = 512.0f);
+
+    /** Insert @p id at @p position, or move it there. Negative ids are ignored. */
+    void Upsert(int id, const Vec3& position);
+
+    /** Drop @p id. Unknown ids are ignored. */
+    void Remove(int id);
+
+    void Clear();
+
+    bool Contains(int id) const;
+    size_t Size() const { return _ids.size(); }
+    float CellSize() const { return _cellSize; }
+
+    /** Stored position of @p id (zero if absent). */
+    Vec3 Position(int id) const;
+
+    /** Append every point within @p radius of @p center to @p out (unordered). */
+    void QueryRadius(const Vec3& center, float radius, std::vector<SpatialHit>& out) const;
+
+    /** Append every point inside the axis-aligned box [@p min, @p max] to @p out (unordered). */
+    void QueryBox(const Vec3& min, const Vec3& max, std::vector<SpatialHit>& out) const;
+
+    /**
+     * Append the @p k points nearest @p center that @p keep accepts (`bool(int id)`), closest
+     * first, ignoring any farther than @p maxDistance. Searches outward in doubling radii, so
+     * a nearby hit never touches the far side of the map. @p keep may query this index itself
+     * ("is anyone else near this one?"); it must not modify it.
+     */
+    template <typename Keep>
+    void Nearest(const Vec3& center, size_t k, std::vector<SpatialHit>& out, Keep&& keep,
+                 float maxDistance = std::numeric_limits<float>::infinity()) const
+    {
+        if (k == 0 || _ids.empty())
+            return;
+
+        // Taken out of the member for the call: a nested query from `keep` then works on its
+        // own buffer instead of clearing this one under the filter.
+        std::vector<SpatialHit> hits = std::move(_nearestScratch);
+        const float reach = Reach(center);
+        float radius = _cellSize;
+        while (true)
+        {
+            const bool last = radius >= maxDistance || radius >= reach;
+            if (last)  // past the bounds every point is in range; only maxDistance still limits
+                radius = maxDistance < reach ? maxDistance : std::numeric_limits<float>::infinity();
+            hits.clear();
+            QueryRadius(center, radius, hits);
+            std::erase_if(hits, [&](const SpatialHit& hit) { return !keep(hit.Id); });
+            // With k accepted hits inside `radius`, nothing outside it can be among the nearest k.
+            if (hits.size() >= k || last)
+                break;
+            radius *= 2.0f;
+        }
+        TakeNearest(hits, k, out);
+        _nearestScratch = std::move(hits);
+    }
+
+    /** @ref Nearest without a filter. */
+    void Nearest(const Vec3& center, size_t k, std::vector<SpatialHit>& out,
+                 float maxDistance = std::numeric_limits<float>::infinity()) const
+    {
+        Nearest(center, k, out, [](int) { return true; }, maxDistance);
+    }
+
+private:
+    struct CellCoord
+    {
+        int32_t X;
+        int32_t Y;
+    };
+
+    CellCoord CellOf(float x, float y) const;
+    static int64_t CellKey(CellCoord cell) { return (static_cast<int64_t>(cell.X) << 32) | static_cast<uint32_t>(cell.Y); }
+
+    /** Distance from @p center to the farthest corner of the points' bounds: no point lies farther. */
+    float Reach(const Vec3& center) const;
+
+    /**
+     * Copy the points of every cell overlapping [min, max] (x/y) into the candidate scratch.
+     * Returns false, gathering nothing, when scanning all points directly is cheaper.
+     */
+    bool Gather(const Vec3& min, const Vec3& max) const;
+
+    /** Append the points whose `_distSq` entry is <= @p limitSq. */
+    void Emit(float limitSq, bool gathered, std::vector<SpatialHit>& out) const;
+    static void TakeNearest(std::vector<SpatialHit>& hits, size_t k, std::vector<SpatialHit>& out);
+
+    float _cellSize;
+    float _inverseCellSize;
+    Vec3 _boundsMin;  // grow-only bounds of every point inserted since the last Clear
+    Vec3 _boundsMax;
+
+    // Dense point storage, [dense index]. Removal swaps the last point into the hole.
+    std::vector<int> _ids;
+    std::vector<float> _x;
+    std::vector<float> _y;
+    std::vector<float> _z;
+    std::vector<int64_t> _cellKey;
+
+    std::vector<int> _denseOf;  // [id] -> dense index, -1 when absent
+    std::unordered_map<int64_t, std::vector<uint32_t>> _cells;  // cell -> dense indices
+
+    // Query scratch, reused across calls: gathered candidates as contiguous x/y/z, then their distances.
+    mutable std::vector<uint32_t> _candidates;
+    mutable std::vector<float> _cx;
+    mutable std::vector<float> _cy;
+    mutable std::vector<float> _cz;
+    mutable std::vector<float> _distSq;
+    mutable std::vector<SpatialHit> _nearestScratch;
+};
+
+}  // namespace CS2Kit::Sdk
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <CS2Kit/Core/Profiler.hpp>
+#include <CS2Kit/Core/Slot.hpp>
+#include <CS2Kit/Sdk/SpatialIndex.hpp>
+#include <cstdint>
+#include <vector>
+
+class CEntityInstance;
+
+namespace CS2Kit::Sdk
+{
+
+/**
+ * @brief The kit's per-frame @ref SpatialIndex of alive players plus any entities a plugin opts in.
+ *
+ * @ref Update runs once per GameFrame, right after the @ref PlayerSnapshot capture. It
+ * upserts every alive player's origin from the snapshot and every tracked entity's scene-node
+ * origin. Most points stay in their cell from one frame to the next, so the refresh rarely
+ * touches the grid. Dead or empty slots are removed, and so is a tracked entity whose handle
+ * no longer resolves, which means deleted entities drop out on their own.
+ *
+ * Ids in query results are player slots (`< Core::MaxPlayers`), or @ref EntityIdBase plus
+ * the entity index for tracked entities; see @ref IsPlayerId / @ref EntityIndexOf.
+ *
+ * @code
+ * std::vector<Sdk::SpatialHit> hits;
+ * auto& spatial = Engine().Spatial;
+ * spatial.Index().Nearest(origin, 3, hits, [](int id) { return Sdk::SpatialService::IsPlayerId(id); });
+ * @endcode
+ *
+ * Positions are as of the frame's update: a teleport takes effect in the index next frame.
+ */
+class SpatialService
+{
+public:
+    static constexpr int EntityIdBase = Core::MaxPlayers;
+
+    static bool IsPlayerId(int id) { return id >= 0 && id < EntityIdBase; }
+    static int EntityIndexOf(int id) { return id - EntityIdBase; }
+
+    /** Refresh players and tracked entities. Called by the kit's OnGameFrame. */
+    void Update();
+
+    /** Start indexing @p entity (by handle) from the next Update. Re-tracking is a no-op. */
+    void Track(CEntityInstance* entity);
+
+    /** Stop indexing @p entity and drop it from the index now. */
+    void Untrack(CEntityInstance* entity);
+
+    /** Forget tracked entities and every indexed point (map change). */
+    void Clear();
+
+    size_t TrackedCount() const { return _tracked.size(); }
+
+    /** The index; valid for queries between frames. */
+    const SpatialIndex& Index() const { return _index; }
+
+private:
+    /** Upsert a tracked entity's origin; drops it and returns false once the entity is gone. */
+    bool UpdateEntity(CEntityInstance* entity, uint32_t handle);
+
+    SpatialIndex _index;
+    std::vector<uint32_t> _tracked;  // entity handles
+    Core::ProbePoint _probe{"spatial.update"};
+};
+
+}  // namespace CS2Kit::Sdk
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <CS2Kit/Core/Profiler.hpp>
 #include <CS2Kit/Core/Slot.hpp>
 #include <array>
 #include <vector>
@@ -47,6 +48,9 @@ public:
     /** Transmit `entityIndex` only to `beneficiarySlot`. Re-registering updates the beneficiary. */
     void SetEntityExclusive(int entityIndex, int beneficiarySlot);
 
+    /** Transmit `entityIndex` to no client at all (parked pool entities). Cleared like an exclusive entity. */
+    void HideEntity(int entityIndex);
+
     /** Stop filtering `entityIndex`; it transmits normally again. Safe on unknown indices. */
     void ClearEntityExclusive(int entityIndex);
 
@@ -66,15 +70,19 @@ private:
     struct ExclusiveEntity
     {
         int EntityIndex;
-        int BeneficiarySlot;
+        int BeneficiarySlot;  // NoBeneficiary: hidden from everyone
     };
 
+    static constexpr int NoBeneficiary = -1;
+
+    void SetExclusive(int entityIndex, int beneficiarySlot);
     void SetFlag(int slot, bool SlotState::* flag, bool value);
 
     std::array<SlotState, Core::MaxPlayers> _state{};
     std::vector<ExclusiveEntity> _exclusive; /**< Entities transmitted only to their beneficiary. */
     int _activeCount = 0;                    /**< Slots with any flag set; OnCheckTransmit early-outs at 0. */
     int _slotOffset = -1;                    /**< Recipient player-slot byte offset inside CCheckTransmitInfo. */
+    Core::ProbePoint _probe{"transmit.check"};
 };
 
 }  // namespace CS2Kit::Sdk
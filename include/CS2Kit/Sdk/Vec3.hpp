@@ -0,0 +1,17 @@
+#pragma once
+
+namespace CS2Kit::Sdk
+{
+
+/**
+ * @brief Plain x/y/z triple with the layout of the SDK's Vector and QAngle (pitch, yaw, roll).
+ * Lets SDK-free code and headers carry positions; AngleMath's templates accept it directly.
+ */
+struct Vec3
+{
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+};
+
+}  // namespace CS2Kit::Sdk
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace CS2Kit::Utils
+{
+
+/**
+ * @brief A string literal usable as a template argument (`Foo<"CBaseEntity">`).
+ *
+ * Structural, so two uses with the same text name the same instantiation. @p N counts the
+ * terminating NUL, which `Value` keeps so `CStr()` can go straight to C APIs.
+ */
+template <size_t N>
+struct FixedString
+{
+    char Value[N]{};
+
+    constexpr FixedString(const char (&text)[N])
+    {
+        for (size_t i = 0; i < N; ++i)
+            Value[i] = text[i];
+    }
+
+    constexpr const char* CStr() const { return Value; }
+    constexpr std::string_view View() const { return {Value, N - 1}; }
+    static constexpr size_t Size() { return N - 1; }
+};
+
+}  // namespace CS2Kit::Utils
@@ -4,6 +4,7 @@
 #include <CS2Kit/CS2Kit.hpp>
 #include <CS2Kit/Core/ILogger.hpp>
 #include <CS2Kit/Core/Paths.hpp>
+#include <CS2Kit/Core/Registry.hpp>
 #include <CS2Kit/Core/Scheduler.hpp>
 #include <CS2Kit/Core/Services.hpp>
 #include <CS2Kit/Menu/MenuManager.hpp>
@@ -17,9 +18,12 @@
 #include <CS2Kit/Sdk/PrecacheService.hpp>
 #include <CS2Kit/Sdk/UserMessage.hpp>
 #include <CS2Kit/Utils/Log.hpp>
+#include <CS2Kit/Utils/StringUtils.hpp>
 #include <ISmmAPI.h>
 #include <chrono>
 #include <eiface.h>
+#include <filesystem>
+#include <fstream>
 #include <engine/igameeventsystem.h>
 #include <format>
 #include <icvar.h>
@@ -34,8 +38,45 @@ namespace CS2Kit
 {
 
 static constexpr const char* DefaultGameDataPath = "addons/cs2-kit/gamedata/signatures.jsonc";
+static constexpr size_t ProfileSectionProbes = 10;  // heaviest probes only; RCON truncates long replies
+static constexpr const char* TraceDirectory = "addons/cs2-kit/traces";
+static constexpr const char* OffsetCachePath = "addons/cs2-kit/cache/offsets.json";
 static Core::ConsoleLogger g_consoleLogger;
 
+// Serialising ~100k events takes milliseconds: do it, and the file write, on the pool.
+static void WriteTrace(Core::Services& services, Core::TraceCapture capture)
+{
+    const auto stamp = std::chrono::duration_cast<std::chrono::seconds>(
+                          std::chrono::system_clock::now().time_since_epoch())
+                          .count();
+    auto path = Core::ResolvePath(std::format("{}/trace-{}.json", TraceDirectory, stamp));
+
+    services.ThreadPool.Run(
+        [capture = std::move(capture), path]() -> std::string {
+            std::error_code ec;
+            std::filesystem::create_directories(path.parent_path(), ec);
+            std::ofstream file(path, std::ios::binary);
+            if (!file.is_open())
+                return {};
+            file << capture.ToChromeJson();
+            return file.good() ? std::format("{} frames, {} spans, {} dropped", capture.Frames, capture.Spans.size(),
+                                             capture.Dropped)
+                               : std::string{};
+        },
+        [path](const std::string& summary) {
+            if (summary.empty())
+                Utils::Log::Error("Profiler: failed to write trace {}", path.string());
+            else
+                Utils::Log::Info("Profiler: trace written to {} ({})", path.string(), summary);
+        });
+}
+
+static void SaveOffsetCache(Core::Services& services)
+{
+    if (services.OffsetCache.Dirty() && !services.OffsetCache.Save(Core::ResolvePath(OffsetCachePath)))
+        Utils::Log::Warn("Offset cache: could not write {}.", OffsetCachePath);
+}
+
 bool Initialize(ISmmAPI* ismm, char* error, size_t maxlen, Core::Services& services, const InitParams& params)
 {
     // 1. Set up logging
@@ -99,15 +140,22 @@ bool Initialize(ISmmAPI* ismm, char* error, size_t maxlen, Core::Services& servi
     using Core::StageResult;
     auto& report = services.LoadReport;
 
+    // Entries for a module whose build changed are dropped here; they are rescanned below and rewritten.
+    services.OffsetCache.Load(Core::ResolvePath(OffsetCachePath));
+    if (services.OffsetCache.StaleModules() > 0)
+        Utils::Log::Info("Offset cache: {} module(s) changed build since the last load; rescanning.",
+                         services.OffsetCache.StaleModules());
+
     report.Run("GameData", [&] {
         const char* gameDataPath = params.GameDataPath ? params.GameDataPath : DefaultGameDataPath;
         if (!services.GameData.Load(gameDataPath))
             return StageResult::Degraded(std::format("failed to load {}", gameDataPath));
-        services.GameData.ResolveAll();
+        services.GameData.ResolveAll(&services.OffsetCache);
         if (auto failures = services.GameData.FailureSummary(); !failures.empty())
             return StageResult::Degraded(std::move(failures));
-        return StageResult::Ok(std::format("{} offsets, {} signatures resolved", services.GameData.OffsetCount(),
-                                           services.GameData.SignatureCount()));
+        return StageResult::Ok(std::format("{} offsets, {} signatures resolved ({} from cache)",
+                                           services.GameData.OffsetCount(), services.GameData.SignatureCount(),
+                                           services.GameData.CachedCount()));
     });
 
     const auto messages = report.Run("Messages", [&] {
@@ -128,6 +176,28 @@ bool Initialize(ISmmAPI* ismm, char* error, size_t maxlen, Core::Services& servi
     };
 
     degradable("Schema", "init failed; button detection may not work", [&] { return services.Schema().Initialize(); });
+
+    // Every SchemaField the kit and plugin declare, resolved now - one read per class - so no
+    // accessor pays a lookup mid-round, and a game update's schema drift is reported in one place.
+    report.Run("SchemaFields", [&] {
+        if (!report.IsOk("Schema"))
+            return StageResult::Skipped("schema system unavailable");
+        const auto result = services.Schema().Prewarm(Core::Registry<Sdk::SchemaFieldDecl>::Items());
+        std::string problems;
+        if (!result.Missing.empty())
+            problems = std::format("{}/{} missing: {}", result.Missing.size(), result.Fields,
+                                   Utils::StringUtils::Join(result.Missing, ", "));
+        if (!result.Drifted.empty())
+        {
+            if (!problems.empty())
+                problems += "; ";
+            problems += std::format("drifted: {}", Utils::StringUtils::Join(result.Drifted, ", "));
+        }
+        if (!problems.empty())
+            return StageResult::Degraded(std::move(problems));
+        return StageResult::Ok(std::format("{} fields in {} classes ({} read, the rest cached)", result.Fields,
+                                           result.Classes, result.Walked));
+    });
     degradable("Entities", "init failed; menus may not work", [&] { return services.Entities.Initialize(); });
     degradable("EntityOps", "unavailable; spawned effects degrade (see signature warnings)",
                [&] { return services.EntityOps.Initialize(); });
@@ -140,11 +210,14 @@ bool Initialize(ISmmAPI* ismm, char* error, size_t maxlen, Core::Services& servi
     degradable("Transmit", "inert; CheckTransmitPlayerSlot offset missing from gamedata",
                [&] { return services.Transmit.Initialize(); });
 
+    services.Scheduler.SetProfiler(&services.Profiler);
+
     // Per-frame subsystems pump through the scheduler (PostgresDatabase registers its own pump
     // in Start), so OnGameFrame has exactly one thing to tick. CancelAll in Shutdown unhooks
     // these; Initialize re-registers them on the next load.
     services.Scheduler.EveryFrame([&services] { services.Menus.OnGameFrame(); });
     services.Scheduler.EveryFrame([&services] { services.Http.DispatchCompletions(); });
+    services.Scheduler.EveryFrame([&services] { services.ThreadPool.DispatchCompletions(); });
 
     // Kit status sections; plugins add theirs in OnLoad. Providers capture `services` by
     // reference - it outlives them (both live for one Load/Unload cycle).
@@ -164,7 +237,9 @@ bool Initialize(ISmmAPI* ismm, char* error, size_t maxlen, Core::Services& servi
 
     services.Status.RegisterSection("gamedata", [&services] {
         auto section = nlohmann::json{{"offsets", services.GameData.OffsetCount()},
-                                      {"signatures", services.GameData.SignatureCount()}};
+                                      {"signatures", services.GameData.SignatureCount()},
+                                      {"signatures_cached", services.GameData.CachedCount()},
+                                      {"schema_fields_cached", services.OffsetCache.FieldCount()}};
         for (const auto& [name, entry] : services.GameData.Resolutions())
         {
             if (!entry.Error.empty())
@@ -175,11 +250,60 @@ bool Initialize(ISmmAPI* ismm, char* error, size_t maxlen, Core::Services& servi
         return section;
     });
 
+    services.Status.RegisterSection("scheduler", [&services] {
+        const auto defer = services.Scheduler.GetDeferStats();
+        return nlohmann::json{{"timers", services.Scheduler.TimerCount()},
+                              {"tasks", services.Tasks.Count()},
+                              {"deferred_queued", defer.Queued},
+                              {"deferred_executed", defer.Executed},
+                              {"defer_budget_us", defer.BudgetUs},
+                              {"defer_last_drain_us", defer.LastDrainUs},
+                              {"defer_overruns", defer.Overruns}};
+    });
+
+    services.Status.RegisterSection("profile", [&services] {
+        auto probes = nlohmann::json::array();
+        for (const auto& probe : services.Profiler.Snapshot(ProfileSectionProbes))
+            probes.push_back({{"name", probe.Name},
+                              {"calls", probe.Calls},
+                              {"p50_us", probe.P50Us},
+                              {"p99_us", probe.P99Us},
+                              {"max_us", probe.MaxUs},
+                              {"window_ms", probe.WindowMs}});
+        return nlohmann::json{{"enabled", services.Profiler.Enabled()}, {"probes", std::move(probes)}};
+    });
+
+    services.Status.RegisterSection("entity_io", [&services] {
+        const auto& ops = services.EntityOps;
+        const auto& last = ops.LastFlushCounts();
+        const auto& total = ops.TotalCounts();
+        return nlohmann::json{{"queued", ops.QueuedCount()},
+                              {"spawns", last.Spawns},
+                              {"inputs", last.Inputs},
+                              {"keyvalues", last.KeyValues},
+                              {"removals", last.Removals},
+                              {"coalesced", last.Coalesced},
+                              {"dropped", last.Dropped},
+                              {"total_commands", total.Spawns + total.Inputs + total.KeyValues + total.Removals},
+                              {"total_coalesced", total.Coalesced},
+                              {"total_dropped", total.Dropped},
+                              {"pooled", ops.Pool().ParkedCount()},
+                              {"pool_reuses", ops.Pool().ReuseCount()}};
+    });
+
+    services.Status.RegisterSection("threadpool", [&services] {
+        return nlohmann::json{{"threads", services.ThreadPool.ThreadCount()},
+                              {"queued", services.ThreadPool.Queued()},
+                              {"completed", services.ThreadPool.Completed()}};
+    });
+
     services.Status.RegisterSection("uptime", [start = std::chrono::steady_clock::now()] {
         const auto uptime = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - start);
         return nlohmann::json{{"seconds", uptime.count()}};
     });
 
+    // Signatures are all known by now; schema fields keep arriving lazily and are saved again on Shutdown.
+    SaveOffsetCache(services);
     return true;
 }
 
@@ -187,13 +311,27 @@ void Shutdown(Core::Services& services)
 {
     services.Precache.Shutdown();  // first: the engine must stop referencing our vtables
     services.Events.RemoveAllListeners();
+    services.EntityOps.Pool().Shutdown();  // parked entities would outlive the plugin otherwise
+    services.EntityOps.FlushForShutdown();  // no frame follows: queued removals must go out now
+    services.Entities.Shutdown();  // the engine must stop calling our entity listener
+    services.Tasks.CancelAll();  // unwind suspended coroutines; their late completions see a dead token
     services.Http.Stop();  // drains in-flight requests before their completion targets go away
+    services.ThreadPool.Stop();  // joins the workers; queued jobs and undispatched completions are dropped
     services.Scheduler.CancelAll();
+    SaveOffsetCache(services);
 }
 
 void OnGameFrame(Core::Services& services)
 {
+    services.Profiler.BeginFrame();
+    services.Snapshot.Capture();  // before any frame callback reads it
+    services.Spatial.Update();
     services.Scheduler.OnGameFrame();
+    services.EntityOps.FlushQueued();  // after every frame callback has had its chance to queue
+    services.Profiler.EndFrame();
+
+    if (auto capture = services.Profiler.TakeCapture())
+        WriteTrace(services, std::move(*capture));
 }
 
 void OnPlayerDisconnect(Core::Services& services, int slot)
@@ -201,6 +339,7 @@ void OnPlayerDisconnect(Core::Services& services, int slot)
     services.Menus.OnPlayerDisconnect(slot);
     services.ChatInput.OnPlayerDisconnect(slot);
     services.Transmit.OnPlayerDisconnect(slot);
+    services.Snapshot.Invalidate(slot);
 }
 
 }  // namespace CS2Kit
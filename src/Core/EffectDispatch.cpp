@@ -11,14 +11,17 @@ namespace
 {
 
 // Build the EffectSpec from the descriptor's declarative lifetime plus the body's instance.
-EffectSpec MakeSpec(EffectScope scope, int tickIntervalMs, int durationMs, EffectInstance inst)
+template <class Descriptor>
+EffectSpec MakeSpec(const Descriptor& effect, EffectInstance inst, BatchTickCallback batch = {}, int batchKey = 0)
 {
-    return {.TickIntervalMs = tickIntervalMs,
-            .DurationMs = durationMs,
-            .RoundScoped = scope == EffectScope::Round,
-            .SurvivesDeath = scope == EffectScope::Session,
-            .OnTick = std::move(inst.OnTick),
-            .OnStop = std::move(inst.OnStop)};
+    return EffectSpec{.TickIntervalMs = effect.TickIntervalMs,
+                      .DurationMs = effect.DurationMs,
+                      .RoundScoped = effect.Scope == EffectScope::Round,
+                      .SurvivesDeath = effect.Scope == EffectScope::Session,
+                      .OnTick = std::move(inst.OnTick),
+                      .OnStop = std::move(inst.OnStop),
+                      .OnTickBatch = std::move(batch),
+                      .BatchKey = batchKey};
 }
 
 // Shared body for the Clear verbs (both key off Permission/Id/OffKey only).
@@ -54,9 +57,8 @@ void ApplyEffect(EffectManager& effects, int adminSlot, int targetSlot, const Ef
     EffectInstance inst = effect.Setup ? effect.Setup(ctx) : EffectInstance{};
     // Register only when there is state to track: a pure fire-and-forget never occupies the slot
     // map, so IsActive stays false and no stale toggle state lingers.
-    if (inst.OnTick || inst.OnStop || effect.DurationMs > 0)
-        effects.Apply(targetSlot, effect.Id,
-                      MakeSpec(effect.Scope, effect.TickIntervalMs, effect.DurationMs, std::move(inst)));
+    if (inst.OnTick || inst.OnStop || effect.OnTickBatch || effect.DurationMs > 0)
+        effects.Apply(targetSlot, effect.Id, MakeSpec(effect, std::move(inst), effect.OnTickBatch));
 
     BroadcastKey(ctx, effect.OnKey);
 }
@@ -85,8 +87,11 @@ void ApplyEffect(EffectManager& effects, int adminSlot, int targetSlot, int para
         return;
 
     EffectInstance inst = effect.Setup(ctx, param);
-    effects.Apply(targetSlot, effect.Id,
-                  MakeSpec(effect.Scope, effect.TickIntervalMs, effect.DurationMs, std::move(inst)));
+    // One tick group per param, each bound to its own value.
+    BatchTickCallback batch;
+    if (effect.OnTickBatch)
+        batch = [body = effect.OnTickBatch, param](std::span<const int> slots) { body(slots, param); };
+    effects.Apply(targetSlot, effect.Id, MakeSpec(effect, std::move(inst), std::move(batch), param));
     BroadcastKey(ctx, effect.OnKey);
 }
 
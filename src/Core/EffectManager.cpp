@@ -1,92 +1,170 @@
 #include <CS2Kit/Core/EffectManager.hpp>
+#include <CS2Kit/Utils/Log.hpp>
+#include <algorithm>
+#include <bit>
 #include <utility>
-#include <vector>
 
 namespace CS2Kit::Core
 {
 
-namespace
+EffectManager::~EffectManager()
 {
-bool ValidSlot(int slot)
-{
-    return slot >= 0 && slot < EffectManager::MaxSlots;
-}
-}  // namespace
-
-bool EffectManager::IsActive(int slot, int effectId) const
-{
-    if (!ValidSlot(slot))
-        return false;
-    auto it = _effects[slot].find(effectId);
-    // A self-expired effect (DurationMs elapsed) leaves its entry behind until reclaimed; its
-    // ScheduledEffect reports inactive, so treat that as not-active without touching the map.
-    return it != _effects[slot].end() && it->second.Fx.Active();
+    CancelAll();
 }
 
 void EffectManager::Apply(int slot, int effectId, EffectSpec spec)
 {
     if (!ValidSlot(slot))
         return;
+    if (!ValidId(effectId))
+    {
+        Utils::Log::Warn("EffectManager: effect id {} is outside [0, {}); ignored.", effectId, MaxEffectIds);
+        return;
+    }
+
+    // Re-apply semantics: replace any active instance. An onStop may re-apply this id from inside
+    // Cancel; stop that instance too, so the slot is fully detached (timer, batch group) before reuse.
+    while (IsActive(slot, effectId))
+        Cancel(slot, effectId);
 
-    Cancel(slot, effectId);  // re-apply semantics: replace any active instance
+    auto& entry = _entries[slot][effectId];
 
-    _effects[slot].insert_or_assign(
-        effectId, ActiveEffect{.RoundScoped = spec.RoundScoped,
-                               .SurvivesDeath = spec.SurvivesDeath,
-                               .Fx = ScheduledEffect(_scheduler, spec.TickIntervalMs, spec.DurationMs,
-                                                     std::move(spec.OnTick), std::move(spec.OnStop))});
+    // Expiry is the manager's timer rather than ScheduledEffect's, so the active bit clears with it.
+    const bool batched = spec.OnTickBatch && spec.TickIntervalMs > 0;
+    entry.Fx = ScheduledEffect(_pool, _scheduler, spec.TickIntervalMs, 0,
+                               batched ? Scheduler::Callback{} : std::move(spec.OnTick), std::move(spec.OnStop));
+    if (batched)
+    {
+        JoinGroup(slot, effectId, spec.TickIntervalMs, spec.BatchKey, std::move(spec.OnTickBatch));
+        entry.BatchIntervalMs = spec.TickIntervalMs;
+        entry.BatchKey = spec.BatchKey;
+    }
+    if (spec.DurationMs > 0)
+        entry.ExpireTimer = _scheduler.Delay(spec.DurationMs, [this, slot, effectId] { Expire(slot, effectId); });
+
+    const uint64_t bit = uint64_t{1} << effectId;
+    _active[slot] |= bit;
+    _roundScoped[slot] = spec.RoundScoped ? _roundScoped[slot] | bit : _roundScoped[slot] & ~bit;
+    _survivesDeath[slot] = spec.SurvivesDeath ? _survivesDeath[slot] | bit : _survivesDeath[slot] & ~bit;
 }
 
 void EffectManager::Cancel(int slot, int effectId)
 {
-    if (!ValidSlot(slot))
+    if (!IsActive(slot, effectId))
         return;
-    auto it = _effects[slot].find(effectId);
-    if (it == _effects[slot].end())
+
+    // Detach before stopping so a re-entrant Apply sees a clean slot. Stop() runs onStop once.
+    auto& entry = _entries[slot][effectId];
+    ScheduledEffect fx = std::move(entry.Fx);
+    if (entry.ExpireTimer != 0)
+        _scheduler.Cancel(std::exchange(entry.ExpireTimer, 0));
+    if (entry.BatchIntervalMs > 0)
+        LeaveGroup(slot, effectId, std::exchange(entry.BatchIntervalMs, 0), std::exchange(entry.BatchKey, 0));
+
+    const uint64_t bit = uint64_t{1} << effectId;
+    _active[slot] &= ~bit;
+    _roundScoped[slot] &= ~bit;
+    _survivesDeath[slot] &= ~bit;
+    fx.Stop();
+}
+
+void EffectManager::Expire(int slot, int effectId)
+{
+    _entries[slot][effectId].ExpireTimer = 0;  // firing now; nothing left to cancel
+    Cancel(slot, effectId);
+}
+
+EffectManager::TickGroup* EffectManager::FindGroup(int effectId, int intervalMs, int key) const
+{
+    auto it = std::find_if(_groups.begin(), _groups.end(), [&](const auto& g) {
+        return g->EffectId == effectId && g->IntervalMs == intervalMs && g->Key == key;
+    });
+    return it == _groups.end() ? nullptr : it->get();
+}
+
+void EffectManager::JoinGroup(int slot, int effectId, int intervalMs, int key, BatchTickCallback tick)
+{
+    TickGroup* group = FindGroup(effectId, intervalMs, key);
+    if (group == nullptr)
+    {
+        auto created = std::make_unique<TickGroup>(
+            TickGroup{.EffectId = effectId, .IntervalMs = intervalMs, .Key = key, .Tick = std::move(tick)});
+        group = created.get();
+        group->Timer = _scheduler.Repeat(intervalMs, [this, group] { RunGroup(group); });
+        _groups.push_back(std::move(created));
+    }
+    group->Slots |= uint64_t{1} << slot;
+}
+
+void EffectManager::LeaveGroup(int slot, int effectId, int intervalMs, int key)
+{
+    TickGroup* group = FindGroup(effectId, intervalMs, key);
+    if (group == nullptr)
         return;
+    group->Slots &= ~(uint64_t{1} << slot);
+    if (group->Slots == 0 && !group->Running)
+        RemoveGroup(group);
+}
+
+void EffectManager::RunGroup(TickGroup* group)
+{
+    std::array<int, MaxSlots> slots;
+    size_t count = 0;
+    for (uint64_t bits = group->Slots; bits != 0; bits &= bits - 1)
+        slots[count++] = std::countr_zero(bits);
 
-    // Detach before stopping so a re-entrant Apply sees a clean slot. Stop() runs onStop once
-    // (a no-op if the effect already self-expired).
-    ActiveEffect entry = std::move(it->second);
-    _effects[slot].erase(it);
-    entry.Fx.Stop();
+    group->Running = true;
+    group->Tick(std::span<const int>(slots.data(), count));
+    group->Running = false;
+
+    // The body may have cancelled every member (its own onStops included).
+    if (group->Slots == 0)
+        RemoveGroup(group);
+}
+
+void EffectManager::RemoveGroup(TickGroup* group)
+{
+    _scheduler.Cancel(group->Timer);
+    std::erase_if(_groups, [group](const auto& g) { return g.get() == group; });
 }
 
-void EffectManager::CancelWhere(int slot, const std::function<bool(int id, const ActiveEffect&)>& keep)
+void EffectManager::CancelMask(int slot, uint64_t mask)
 {
-    std::vector<int> ids;
-    ids.reserve(_effects[slot].size());
-    for (const auto& [id, entry] : _effects[slot])
-        if (keep(id, entry))
-            ids.push_back(id);
-    for (int id : ids)
+    // Snapshot of the bits to visit; effects an onStop applies mid-sweep are not part of it.
+    uint64_t pending = _active[slot] & mask;
+    while (pending != 0)
+    {
+        const int id = std::countr_zero(pending);
+        pending &= pending - 1;
         Cancel(slot, id);
+        pending &= _active[slot];  // an onStop may have cancelled some already
+    }
 }
 
 void EffectManager::CancelAllForSlot(int slot)
 {
-    if (!ValidSlot(slot))
-        return;
-    CancelWhere(slot, [](int, const ActiveEffect&) { return true; });
+    if (ValidSlot(slot))
+        CancelMask(slot, ~uint64_t{0});
 }
 
 void EffectManager::CancelPerLife(int slot)
 {
-    if (!ValidSlot(slot))
-        return;
-    CancelWhere(slot, [](int, const ActiveEffect& e) { return !e.SurvivesDeath; });
+    if (ValidSlot(slot))
+        CancelMask(slot, ~_survivesDeath[slot]);
 }
 
 void EffectManager::CancelRoundScoped()
 {
     for (int slot = 0; slot < MaxSlots; ++slot)
-        CancelWhere(slot, [](int, const ActiveEffect& e) { return e.RoundScoped; });
+        if (_active[slot] & _roundScoped[slot])
+            CancelMask(slot, _roundScoped[slot]);
 }
 
 void EffectManager::CancelAll()
 {
     for (int slot = 0; slot < MaxSlots; ++slot)
-        CancelAllForSlot(slot);
+        if (_active[slot] != 0)
+            CancelMask(slot, ~uint64_t{0});
 }
 
 }  // namespace CS2Kit::Core
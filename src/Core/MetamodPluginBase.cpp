@@ -174,7 +174,11 @@ void MetamodPluginBase::Hook_StartupServer(const GameSessionConfiguration_t&, IS
                                            const char* mapName)
 {
     Log::Info("Server startup: map '{}'.", mapName ? mapName : "<none>");
+    _services->Entities.OnServerStartup();
     _services->Events.OnServerStartup();
+    _services->Snapshot.InvalidateAll();  // its pointers belong to the previous map
+    _services->Spatial.Clear();           // tracked handles belong to the previous map
+    _services->EntityOps.Pool().Clear();  // so do parked entities, already destroyed with it
     OnServerStartup(mapName ? mapName : "");
 }
 
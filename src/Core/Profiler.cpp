@@ -0,0 +1,268 @@
+#include <CS2Kit/Core/Profiler.hpp>
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <limits>
+#include <string>
+#include <utility>
+
+namespace CS2Kit::Core
+{
+
+int64_t Profiler::NowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+ProbeId Profiler::Probe(std::string_view name)
+{
+    std::string key(name);
+    if (auto it = _byName.find(key); it != _byName.end())
+        return it->second;
+
+    auto data = std::make_unique<ProbeData>();
+    data->Name = key;
+    _probes.push_back(std::move(data));
+    const auto id = static_cast<ProbeId>(_probes.size());
+    _byName.emplace(std::move(key), id);
+    return id;
+}
+
+ProbeId Profiler::SiteProbe(std::string_view kind, const std::source_location& site)
+{
+    std::string_view file = site.file_name();
+    if (const size_t slash = file.find_last_of("/\\"); slash != std::string_view::npos)
+        file.remove_prefix(slash + 1);
+    return Probe(std::format("{} {}:{}", kind, file, site.line()));
+}
+
+void Profiler::Record(ProbeId id, int64_t startNs, int64_t elapsedNs)
+{
+    if (id == 0 || id > _probes.size())
+        return;
+    const auto clamped = static_cast<uint32_t>(std::clamp<int64_t>(elapsedNs, 0, std::numeric_limits<uint32_t>::max()));
+
+    if (_enabled)
+    {
+        auto& probe = *_probes[id - 1];
+        probe.Samples[probe.Calls % WindowSize] = clamped;
+        ++probe.Calls;
+    }
+
+    if (_capturing)
+    {
+        _ring[_ringWritten % _ring.size()] = {startNs, clamped, id};
+        ++_ringWritten;
+    }
+}
+
+void Profiler::BeginFrame()
+{
+    if (_active)
+        _frameStartNs = NowNs();
+}
+
+void Profiler::EndFrame()
+{
+    // A frame that began before a capture or toggle started is skipped, never half-measured.
+    const int64_t startNs = std::exchange(_frameStartNs, 0);
+    if (!_active || startNs == 0)
+        return;
+    if (_frameProbe == 0)
+        _frameProbe = Probe("GameFrame");
+    Record(_frameProbe, startNs, NowNs() - startNs);
+
+    if (_capturing)
+    {
+        ++_framesCaptured;
+        if (--_framesLeft == 0)
+            StopCapture();
+    }
+}
+
+void Profiler::StartCapture(uint32_t frames)
+{
+    if (frames == 0)
+        return;
+    // Allocated once, up front: recording a span is then a store and an increment.
+    if (_ring.size() != TraceCapacity)
+        _ring.resize(TraceCapacity);
+    _ringWritten = 0;
+    _framesLeft = frames;
+    _framesCaptured = 0;
+    _captureDone = false;
+    _capturing = true;
+    _active = true;
+}
+
+void Profiler::StopCapture()
+{
+    if (!_capturing)
+        return;
+    _capturing = false;
+    _captureDone = true;
+    _active = _enabled;
+}
+
+std::optional<TraceCapture> Profiler::TakeCapture()
+{
+    if (!_captureDone)
+        return std::nullopt;
+    _captureDone = false;
+
+    TraceCapture capture;
+    capture.Frames = _framesCaptured;
+    const size_t size = _ring.size();
+    const size_t kept = std::min<uint64_t>(_ringWritten, size);
+    capture.Dropped = _ringWritten - kept;
+    capture.Spans.reserve(kept);
+    const size_t first = _ringWritten > size ? _ringWritten % size : 0;
+    for (size_t i = 0; i < kept; ++i)
+        capture.Spans.push_back(_ring[(first + i) % size]);
+
+    capture.Names.reserve(_probes.size());
+    for (const auto& probe : _probes)
+        capture.Names.push_back(probe->Name);
+
+    // The ring is 2 MiB; give it back until the next capture.
+    std::vector<TraceSpan>().swap(_ring);
+    _ringWritten = 0;
+    return capture;
+}
+
+void Profiler::Reset()
+{
+    for (auto& probe : _probes)
+        probe->Calls = 0;
+}
+
+std::vector<ProbeStats> Profiler::Snapshot(size_t limit) const
+{
+    std::vector<ProbeStats> out;
+    std::vector<uint32_t> window;
+    for (const auto& probe : _probes)
+    {
+        if (probe->Calls == 0)
+            continue;
+
+        const size_t count = std::min<uint64_t>(probe->Calls, WindowSize);
+        window.assign(probe->Samples.begin(), probe->Samples.begin() + static_cast<std::ptrdiff_t>(count));
+
+        uint64_t sumNs = 0;
+        for (uint32_t ns : window)
+            sumNs += ns;
+
+        // Nearest-rank percentiles. Sorting a copy is fine: this runs on a status query, not per frame.
+        std::sort(window.begin(), window.end());
+        auto at = [&](double q) { return window[std::min(count - 1, static_cast<size_t>(q * static_cast<double>(count)))]; };
+        const uint32_t p50 = at(0.50);
+        const uint32_t p99 = at(0.99);
+        const uint32_t maxNs = window.back();
+
+        out.push_back({.Name = probe->Name,
+                       .Calls = probe->Calls,
+                       .Window = count,
+                       .P50Us = p50 / 1000.0,
+                       .P99Us = p99 / 1000.0,
+                       .MaxUs = maxNs / 1000.0,
+                       .WindowMs = static_cast<double>(sumNs) / 1e6});
+    }
+
+    std::sort(out.begin(), out.end(), [](const ProbeStats& a, const ProbeStats& b) { return a.WindowMs > b.WindowMs; });
+    if (limit > 0 && out.size() > limit)
+        out.resize(limit);
+    return out;
+}
+
+std::string Profiler::BuildText(size_t limit) const
+{
+    const auto stats = Snapshot(limit);
+    if (stats.empty())
+        return _enabled ? "profiler on, no samples yet" : "profiler off";
+
+    size_t width = 5;
+    for (const auto& s : stats)
+        width = std::max(width, s.Name.size());
+
+    std::string out = std::format("{:<{}}  {:>9}  {:>9}  {:>9}  {:>9}  {:>10}\n", "probe", width, "calls", "p50 us",
+                                  "p99 us", "max us", "window ms");
+    for (const auto& s : stats)
+        out += std::format("{:<{}}  {:>9}  {:>9.1f}  {:>9.1f}  {:>9.1f}  {:>10.2f}\n", s.Name, width, s.Calls, s.P50Us,
+                           s.P99Us, s.MaxUs, s.WindowMs);
+    out.pop_back();
+    return out;
+}
+
+namespace
+{
+
+void AppendJsonString(std::string& out, std::string_view text)
+{
+    static constexpr char Hex[] = "0123456789abcdef";
+    out += '"';
+    for (char c : text)
+    {
+        const auto byte = static_cast<unsigned char>(c);
+        if (c == '"' || c == '\\')
+        {
+            out += '\\';
+            out += c;
+        }
+        else if (byte < 0x20)
+        {
+            out += "\\u00";
+            out += Hex[byte >> 4];
+            out += Hex[byte & 0xF];
+        }
+        else
+            out += c;
+    }
+    out += '"';
+}
+
+// Trace-event timestamps are microseconds; keep the nanoseconds as three decimals.
+void AppendMicros(std::string& out, int64_t ns)
+{
+    out += std::to_string(ns / 1000);
+    const auto frac = static_cast<int>(ns % 1000);
+    out += '.';
+    out += static_cast<char>('0' + frac / 100);
+    out += static_cast<char>('0' + frac / 10 % 10);
+    out += static_cast<char>('0' + frac % 10);
+}
+
+}  // namespace
+
+std::string TraceCapture::ToChromeJson() const
+{
+    // Appended by hand rather than through nlohmann: a 300-frame capture is ~100k events.
+    std::string out;
+    out.reserve(Spans.size() * 96 + 96);
+    out += R"({"traceEvents":[)";
+    const int64_t originNs = Spans.empty() ? 0 : Spans.front().StartNs;
+    bool first = true;
+    for (const auto& span : Spans)
+    {
+        if (span.Probe == 0 || span.Probe > Names.size())
+            continue;
+        if (!first)
+            out += ',';
+        first = false;
+        out += R"({"name":)";
+        AppendJsonString(out, Names[span.Probe - 1]);
+        out += R"(,"cat":"cs2kit","ph":"X","ts":)";
+        AppendMicros(out, std::max<int64_t>(span.StartNs - originNs, 0));
+        out += R"(,"dur":)";
+        AppendMicros(out, span.DurationNs);
+        out += R"(,"pid":1,"tid":1})";
+    }
+    out += R"(],"displayTimeUnit":"ms","otherData":{"frames":)";
+    out += std::to_string(Frames);
+    out += R"(,"dropped":)";
+    out += std::to_string(Dropped);
+    out += "}}";
+    return out;
+}
+
+}  // namespace CS2Kit::Core
@@ -0,0 +1,65 @@
+#include <CS2Kit/Core/Profiler.hpp>
+#include <CS2Kit/Core/Services.hpp>
+#include <CS2Kit/Sdk/ServerCommand.hpp>
+#include <charconv>
+#include <string_view>
+#include <tier0/dbg.h>
+#include <tier1/convar.h>
+
+namespace CS2Kit::Core
+{
+
+void Profiler::InstallCommand(const char* name, const char* helpText)
+{
+    _command = std::make_shared<Sdk::ServerCommand>(name, helpText, [name](const CCommand& args) {
+        auto& profiler = Engine().Profiler;
+        const std::string_view verb = args.ArgC() > 1 ? args.Arg(1) : "";
+        if (verb == "on" || verb == "off")
+        {
+            profiler.SetEnabled(verb == "on");
+            Msg("%s: profiler %s\n", name, verb == "on" ? "on" : "off");
+            return;
+        }
+        if (verb == "reset")
+        {
+            profiler.Reset();
+            Msg("%s: samples cleared\n", name);
+            return;
+        }
+        Msg("=== %s ===\n%s\n", name, profiler.BuildText().c_str());
+    });
+}
+
+void Profiler::InstallTraceCommand(const char* name, const char* helpText)
+{
+    _traceCommand = std::make_shared<Sdk::ServerCommand>(name, helpText, [name](const CCommand& args) {
+        auto& profiler = Engine().Profiler;
+        const std::string_view verb = args.ArgC() > 1 ? args.Arg(1) : "";
+        if (verb == "stop")
+        {
+            if (!profiler.Capturing())
+            {
+                Msg("%s: no capture running\n", name);
+                return;
+            }
+            profiler.StopCapture();
+            Msg("%s: capture stopped, writing trace\n", name);
+            return;
+        }
+
+        uint32_t frames = DefaultTraceFrames;
+        if (!verb.empty())
+        {
+            auto [end, ec] = std::from_chars(verb.data(), verb.data() + verb.size(), frames);
+            if (ec != std::errc{} || end != verb.data() + verb.size() || frames == 0)
+            {
+                Msg("usage: %s [frames|stop]\n", name);
+                return;
+            }
+        }
+        profiler.StartCapture(frames);
+        Msg("%s: capturing %u frames\n", name, frames);
+    });
+}
+
+}  // namespace CS2Kit::Core
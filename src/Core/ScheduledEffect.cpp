@@ -5,85 +5,146 @@
 namespace CS2Kit::Core
 {
 
-struct ScheduledEffect::State
+struct ScheduledEffect::Pool::State
 {
     Scheduler* scheduler = nullptr;
     uint64_t tickTimer = 0;
     uint64_t stopTimer = 0;
-    std::function<void()> onStop;
-    bool stopped = false;
+    Scheduler::Callback onStop;
+    uint32_t generation = 1;  // bumped on release; handles carrying an older value are stale
+    bool live = false;
+};
+
+ScheduledEffect::Pool::Pool(size_t capacity) : _states(capacity)
+{
+    _free.reserve(capacity);
+    for (size_t i = capacity; i > 0; --i)
+        _free.push_back(static_cast<uint32_t>(i - 1));
+}
+
+ScheduledEffect::Pool::~Pool() = default;
 
-    void Stop()
+size_t ScheduledEffect::Pool::Capacity() const
+{
+    return _states.size();
+}
+
+size_t ScheduledEffect::Pool::InUse() const
+{
+    return _states.size() - _free.size();
+}
+
+ScheduledEffect::Pool& ScheduledEffect::Pool::Shared()
+{
+    static Pool* pool = new Pool(256);
+    return *pool;
+}
+
+uint32_t ScheduledEffect::Pool::Acquire()
+{
+    uint32_t index;
+    if (_free.empty())
     {
-        if (stopped)
-            return;
-        stopped = true;
-
-        if (scheduler)
-        {
-            if (tickTimer)
-                scheduler->Cancel(tickTimer);
-            if (stopTimer)
-                scheduler->Cancel(stopTimer);
-        }
-        tickTimer = 0;
-        stopTimer = 0;
-
-        if (onStop)
-        {
-            auto cb = std::move(onStop);
-            onStop = nullptr;
-            cb();
-        }
+        index = static_cast<uint32_t>(_states.size());
+        _states.emplace_back();
+        _free.reserve(_states.size());  // keep Stop's push_back from allocating
     }
-};
+    else
+    {
+        index = _free.back();
+        _free.pop_back();
+    }
+    _states[index].live = true;
+    return index;
+}
+
+ScheduledEffect::Pool::State* ScheduledEffect::Pool::Find(uint32_t index, uint32_t generation)
+{
+    if (index >= _states.size())
+        return nullptr;
+    State& state = _states[index];
+    return state.live && state.generation == generation ? &state : nullptr;
+}
+
+void ScheduledEffect::Pool::Stop(uint32_t index, uint32_t generation)
+{
+    State* state = Find(index, generation);
+    if (!state)
+        return;
+
+    if (state->tickTimer)
+        state->scheduler->Cancel(state->tickTimer);
+    if (state->stopTimer)
+        state->scheduler->Cancel(state->stopTimer);
+
+    // Release before onStop runs: it may start new effects (growing _states), and the handle
+    // must already read as stopped if it calls back into this one.
+    auto cb = std::move(state->onStop);
+    *state = State{.generation = state->generation + 1};
+    _free.push_back(index);
+
+    if (cb)
+        cb();
+}
 
 ScheduledEffect::ScheduledEffect(Scheduler& scheduler, int64_t tickIntervalMs, int64_t durationMs,
-                                 std::function<void()> onTick, std::function<void()> onStop)
-    : _state(std::make_shared<State>())
+                                 Scheduler::Callback onTick, Scheduler::Callback onStop)
+    : ScheduledEffect(Pool::Shared(), scheduler, tickIntervalMs, durationMs, std::move(onTick), std::move(onStop))
+{
+}
+
+ScheduledEffect::ScheduledEffect(Pool& pool, Scheduler& scheduler, int64_t tickIntervalMs, int64_t durationMs,
+                                 Scheduler::Callback onTick, Scheduler::Callback onStop)
+    : _pool(&pool), _index(pool.Acquire())
 {
-    _state->scheduler = &scheduler;
-    _state->onStop = std::move(onStop);
+    auto& state = pool._states[_index];
+    _generation = state.generation;
+    state.scheduler = &scheduler;
+    state.onStop = std::move(onStop);
 
     if (onTick && tickIntervalMs > 0)
-        _state->tickTimer = scheduler.Repeat(tickIntervalMs, std::move(onTick));
+        state.tickTimer = scheduler.Repeat(tickIntervalMs, std::move(onTick));
 
     if (durationMs > 0)
     {
-        std::weak_ptr<State> weak = _state;
-        _state->stopTimer = scheduler.Delay(durationMs, [weak]() {
-            if (auto s = weak.lock())
-                s->Stop();
+        // Index + generation instead of a pointer: the timer may outlive the effect's slot.
+        state.stopTimer = scheduler.Delay(durationMs, [pool = &pool, index = _index, generation = _generation] {
+            pool->Stop(index, generation);
         });
     }
 }
 
 ScheduledEffect::~ScheduledEffect()
 {
-    if (_state)
-        _state->Stop();
+    Stop();
+}
+
+ScheduledEffect::ScheduledEffect(ScheduledEffect&& other) noexcept
+    : _pool(std::exchange(other._pool, nullptr)), _index(other._index), _generation(other._generation)
+{
 }
 
 ScheduledEffect& ScheduledEffect::operator=(ScheduledEffect&& other) noexcept
 {
     if (this != &other)
     {
-        if (_state)
-            _state->Stop();
-        _state = std::move(other._state);
+        Stop();
+        _pool = std::exchange(other._pool, nullptr);
+        _index = other._index;
+        _generation = other._generation;
     }
     return *this;
 }
 
 void ScheduledEffect::Stop()
 {
-    if (_state)
-        _state->Stop();
+    if (_pool)
+        _pool->Stop(_index, _generation);
 }
 
 bool ScheduledEffect::Active() const
 {
-    return _state && !_state->stopped;
+    return _pool && _pool->Find(_index, _generation) != nullptr;
 }
 
 }  // namespace CS2Kit::Core
@@ -1,95 +1,279 @@
 #include <CS2Kit/Core/Scheduler.hpp>
+#include <algorithm>
 #include <chrono>
-#include <vector>
+#include <optional>
 
 namespace CS2Kit::Core
 {
 
+namespace
+{
+// Heap order for std::push_heap/pop_heap: "a fires after b", so the front is the earliest entry.
+// Ties break on push order.
+template <class Entry>
+bool FiresLater(const Entry& a, const Entry& b)
+{
+    return a.FireTime != b.FireTime ? a.FireTime > b.FireTime : a.Seq > b.Seq;
+}
+
+// Rebuild the heap once cancelled entries outnumber live ones (and there are enough to matter),
+// so a cancel-heavy workload cannot grow the heap without bound.
+constexpr size_t MinStaleToCompact = 64;
+}  // namespace
+
 int64_t Scheduler::GetCurrentTimeMs() const
 {
     return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch())
         .count();
 }
 
-uint64_t Scheduler::Delay(int64_t delayMs, std::function<void()> callback)
+uint64_t Scheduler::AddTimed(int64_t fireTime, int64_t interval, Callback callback, const Site& site)
+{
+    uint64_t id = _timers.Add({fireTime, interval, std::move(callback), site});
+    Push(id, *_timers.Find(id));
+    return id;
+}
+
+void Scheduler::Push(uint64_t id, Timer& timer)
 {
-    return _timers.Add({GetCurrentTimeMs() + delayMs, 0, std::move(callback)});
+    timer.Queued = true;
+    _queue.push_back({timer.NextFireTime, _nextSeq++, id});
+    std::push_heap(_queue.begin(), _queue.end(), FiresLater<QueueEntry>);
 }
 
-uint64_t Scheduler::Repeat(int64_t intervalMs, std::function<void()> callback)
+uint64_t Scheduler::Delay(int64_t delayMs, Callback callback, Site site)
 {
-    return _timers.Add({GetCurrentTimeMs() + intervalMs, intervalMs, std::move(callback)});
+    return AddTimed(GetCurrentTimeMs() + delayMs, 0, std::move(callback), site);
 }
 
-uint64_t Scheduler::DelayAndRepeat(int64_t delayMs, int64_t intervalMs, std::function<void()> callback)
+uint64_t Scheduler::Repeat(int64_t intervalMs, Callback callback, Site site)
 {
-    return _timers.Add({GetCurrentTimeMs() + delayMs, intervalMs, std::move(callback)});
+    return AddTimed(GetCurrentTimeMs() + intervalMs, intervalMs, std::move(callback), site);
 }
 
-uint64_t Scheduler::NextTick(std::function<void()> callback)
+uint64_t Scheduler::DelayAndRepeat(int64_t delayMs, int64_t intervalMs, Callback callback, Site site)
 {
-    return Delay(0, std::move(callback));
+    return AddTimed(GetCurrentTimeMs() + delayMs, intervalMs, std::move(callback), site);
 }
 
-uint64_t Scheduler::EveryFrame(std::function<void()> callback)
+uint64_t Scheduler::NextTick(Callback callback, Site site)
 {
-    // Interval -1 is the every-frame sentinel: OnGameFrame refires it each frame instead of
-    // erasing it (interval 0 = one-shot) or waiting an interval (> 0).
-    return _timers.Add({0, -1, std::move(callback)});
+    return Delay(0, std::move(callback), site);
+}
+
+uint64_t Scheduler::EveryFrame(Callback callback, Site site)
+{
+    // Interval -1 is the every-frame sentinel: these live in their own lane instead of the heap,
+    // refiring each frame instead of being erased (interval 0 = one-shot) or re-armed (> 0).
+    uint64_t id = _timers.Add({0, -1, std::move(callback), site});
+    _everyFrame.push_back(id);
+    return id;
 }
 
 void Scheduler::Cancel(uint64_t id)
 {
+    Timer* timer = _timers.Find(id);
+    if (!timer)
+        return;
+
+    // The heap (and every-frame lane) entry stays behind and is skipped when reached.
+    bool queued = timer->Queued;
     _timers.Remove(id);
+    if (queued && ++_staleEntries >= MinStaleToCompact && _staleEntries * 2 > _queue.size())
+        CompactQueue();
+}
+
+void Scheduler::Defer(DeferPriority priority, Callback callback)
+{
+    if (callback)
+        _deferred[static_cast<size_t>(priority)].push_back(std::move(callback));
+}
+
+DeferStats Scheduler::GetDeferStats() const
+{
+    size_t queued = 0;
+    for (const auto& lane : _deferred)
+        queued += lane.size();
+    return {.Queued = queued,
+            .Executed = _deferExecuted,
+            .Overruns = _deferOverruns,
+            .LastDrainUs = _lastDrainUs,
+            .BudgetUs = _deferBudgetUs};
 }
 
 void Scheduler::CancelAll()
 {
     _timers.Clear();
+    _queue.clear();
+    _everyFrame.clear();
+    _staleEntries = 0;
+    for (auto& lane : _deferred)
+        lane.clear();
+    _deferWaited = {};
+    ++_clearEpoch;
+}
+
+void Scheduler::CompactQueue()
+{
+    std::erase_if(_queue, [this](const QueueEntry& e) { return !_timers.Find(e.Id); });
+    std::make_heap(_queue.begin(), _queue.end(), FiresLater<QueueEntry>);
+    _staleEntries = 0;
+}
+
+bool Scheduler::Fire(uint64_t id)
+{
+    Timer* timer = _timers.Find(id);
+    if (!timer)
+        return false;
+
+    if (timer->Probe == 0 && _profiler && _profiler->Active())
+        timer->Probe = _profiler->SiteProbe("timer", timer->Registered);
+
+    // Move the callback out while it runs: it can mutate the registry (invalidating `timer`) or
+    // cancel itself, which would otherwise destroy the closure mid-call.
+    auto callback = std::move(timer->Callback);
+    if (callback)
+    {
+        ProfileScope scope(_profiler, timer->Probe);
+        callback();
+    }
+
+    // Re-find: the callback may have cancelled this timer.
+    timer = _timers.Find(id);
+    if (!timer)
+        return false;
+    timer->Callback = std::move(callback);
+    return true;
 }
 
 void Scheduler::OnGameFrame()
 {
-    if (_timers.Empty())
-        return;
+    std::optional<ProfileScope> frame;
+    if (_profiler)
+        frame.emplace(*_profiler, _frameProbe);
+
+    if (!_timers.Empty())
+        FireTimers();
+    DrainDeferred();
+}
 
+void Scheduler::FireTimers()
+{
     int64_t now = GetCurrentTimeMs();
+    // Only the every-frame entries present at frame start fire this frame; ones a callback
+    // appends wait for the next and are kept behind the compacted range below.
+    const size_t laneCount = _everyFrame.size();
+    const uint64_t epoch = _clearEpoch;
 
-    // Snapshot the IDs to fire instead of iterating live: callbacks may Cancel() other timers
-    // (or themselves) or schedule new ones, which mutates the registry mid-loop.
-    std::vector<uint64_t> toFire;
-    for (const auto& [id, t] : _timers.Items())
+    // Pop the whole due batch before firing any of it: timers a callback schedules (even
+    // NextTick) are pushed after this point and wait for the next frame.
+    _due.clear();
+    while (!_queue.empty() && _queue.front().FireTime <= now)
     {
-        if (now >= t.NextFireTime)
-            toFire.push_back(id);
+        std::pop_heap(_queue.begin(), _queue.end(), FiresLater<QueueEntry>);
+        uint64_t id = _queue.back().Id;
+        _queue.pop_back();
+
+        if (Timer* timer = _timers.Find(id))
+        {
+            timer->Queued = false;
+            _due.push_back(id);
+        }
+        else
+        {
+            --_staleEntries;
+        }
     }
 
-    for (uint64_t id : toFire)
+    for (uint64_t id : _due)
     {
-        // Re-find by ID - the timer may have been cancelled by an earlier callback in this batch.
-        Timer* timer = _timers.Find(id);
-        if (!timer)
+        // Skips timers cancelled by an earlier callback in this batch.
+        if (!Fire(id))
             continue;
 
-        // Copy out before invoking - the callback can mutate the registry (invalidating pointers).
-        int64_t interval = timer->Interval;
-        auto callback = timer->Callback;
+        Timer* timer = _timers.Find(id);
+        if (timer->Interval > 0)
+        {
+            timer->NextFireTime = now + timer->Interval;
+            Push(id, *timer);
+        }
+        else
+        {
+            _timers.Remove(id);
+        }
+    }
+
+    // Every-frame lane, compacted in place as cancelled entries are found.
+    size_t kept = 0;
+    for (size_t i = 0; i < laneCount; ++i)
+    {
+        if (_clearEpoch != epoch)
+            return;  // a callback ran CancelAll: the lane is already empty
+        uint64_t id = _everyFrame[i];
+        if (Fire(id))
+            _everyFrame[kept++] = id;
+    }
+    if (_clearEpoch != epoch)
+        return;
+    _everyFrame.erase(_everyFrame.begin() + static_cast<std::ptrdiff_t>(kept),
+                      _everyFrame.begin() + static_cast<std::ptrdiff_t>(laneCount));
+}
+
+void Scheduler::DrainDeferred()
+{
+    using Clock = std::chrono::steady_clock;
+
+    bool any = false;
+    for (const auto& lane : _deferred)
+        any = any || !lane.empty();
+    if (!any)
+        return;
 
-        if (callback)
-            callback();
+    std::optional<ProfileScope> drain;
+    if (_profiler)
+        drain.emplace(*_profiler, _deferProbe);
 
-        // Re-find again: the callback may have cancelled this timer.
-        timer = _timers.Find(id);
-        if (!timer)
-            continue;
+    const auto start = Clock::now();
+    const auto budget = std::chrono::microseconds(_deferBudgetUs);
+    const uint64_t epoch = _clearEpoch;
+    std::array<bool, DeferLanes> served{};
+    size_t ran = 0;
 
-        if (interval > 0)
-            timer->NextFireTime = now + interval;
-        else if (interval < 0)
-            timer->NextFireTime = now;  // every-frame sentinel: due again next frame
-        else
-            _timers.Remove(id);
+    // Pop before running: the item may Defer more work (even onto its own lane) or CancelAll.
+    auto runFront = [&](size_t lane) {
+        Callback callback = std::move(_deferred[lane].front());
+        _deferred[lane].pop_front();
+        served[lane] = true;
+        ++ran;
+        ++_deferExecuted;
+        callback();
+        return _clearEpoch == epoch;
+    };
+
+    // Starvation guard first: a lane passed over too long gets one item ahead of higher ones.
+    for (size_t lane = 1; lane < DeferLanes; ++lane)
+    {
+        if (!_deferred[lane].empty() && _deferWaited[lane] >= MaxDeferWaitFrames && !runFront(lane))
+            return;
     }
+
+    // Then strict priority until the budget is spent; the first item always runs.
+    for (size_t lane = 0; lane < DeferLanes; ++lane)
+    {
+        while (!_deferred[lane].empty() && (ran == 0 || Clock::now() - start < budget))
+        {
+            if (!runFront(lane))
+                return;
+        }
+    }
+
+    const auto elapsed = Clock::now() - start;
+    _lastDrainUs = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+    if (_deferBudgetUs > 0 && elapsed > budget)
+        ++_deferOverruns;
+
+    for (size_t lane = 0; lane < DeferLanes; ++lane)
+        _deferWaited[lane] = (served[lane] || _deferred[lane].empty()) ? 0 : _deferWaited[lane] + 1;
 }
 
 }  // namespace CS2Kit::Core
@@ -0,0 +1,176 @@
+#include <CS2Kit/Core/Task.hpp>
+#include <CS2Kit/Utils/Log.hpp>
+#include <array>
+#include <new>
+
+namespace CS2Kit::Core
+{
+
+namespace Detail
+{
+
+namespace
+{
+
+// Frames are rounded up to 64-byte classes; anything past the largest class goes straight to
+// the global allocator. Freed blocks are kept on per-class free lists for the next frame of
+// that size, so a steady stream of the same coroutines allocates nothing after warm-up.
+constexpr size_t FrameGranularity = 64;
+constexpr size_t FrameClasses = 32;  // up to 2 KiB
+
+struct FreeBlock
+{
+    FreeBlock* Next;
+};
+
+struct FramePool
+{
+    std::array<FreeBlock*, FrameClasses> Free{};
+
+    ~FramePool()
+    {
+        for (FreeBlock* head : Free)
+            while (head)
+                ::operator delete(std::exchange(head, head->Next));
+    }
+};
+
+FramePool& Pool()
+{
+    static FramePool pool;
+    return pool;
+}
+
+size_t ClassOf(size_t size)
+{
+    return (size + FrameGranularity - 1) / FrameGranularity - 1;
+}
+
+}  // namespace
+
+void* AllocateFrame(size_t size)
+{
+    const size_t cls = ClassOf(size);
+    if (cls >= FrameClasses)
+        return ::operator new(size);
+
+    auto& head = Pool().Free[cls];
+    if (head)
+        return std::exchange(head, head->Next);
+    return ::operator new((cls + 1) * FrameGranularity);
+}
+
+void FreeFrame(void* frame, size_t size) noexcept
+{
+    const size_t cls = ClassOf(size);
+    if (cls >= FrameClasses)
+    {
+        ::operator delete(frame);
+        return;
+    }
+
+    auto& head = Pool().Free[cls];
+    head = ::new (frame) FreeBlock{head};
+}
+
+}  // namespace Detail
+
+bool ResumeToken::Alive() const
+{
+    return Host && Host->Alive(Root);
+}
+
+void ResumeToken::operator()() const
+{
+    if (Host)
+        Host->Resume(Root, Handle);
+}
+
+std::coroutine_handle<> TaskPromiseBase::Complete(std::coroutine_handle<> self) noexcept
+{
+    if (Continuation)
+        return Continuation;
+
+    // Root task: copy out what Finish needs, since it frees this promise along with the frame.
+    TaskHost* host = Host;
+    const uint64_t root = Root;
+    std::exception_ptr error = Error;
+    if (host)
+        host->Finish(root, self, std::move(error));
+    return std::noop_coroutine();
+}
+
+void TaskHost::Resume(uint64_t root, std::coroutine_handle<> handle)
+{
+    if (!Alive(root))
+        return;
+
+    ++_running;
+    handle.resume();
+    if (--_running == 0 && !_doomed.empty())
+    {
+        // Nothing is executing any more, so tasks cancelled mid-run can be torn down now.
+        auto doomed = std::move(_doomed);
+        _doomed.clear();
+        for (auto h : doomed)
+            Destroy(h);
+    }
+}
+
+void TaskHost::Finish(uint64_t root, std::coroutine_handle<> handle, std::exception_ptr error) noexcept
+{
+    // A root cancelled while running sits in _doomed instead of the registry; it finished before
+    // it could be torn down, so free it here and forget it.
+    if (!_roots.Remove(root))
+        std::erase(_doomed, handle);
+    handle.destroy();  // suspended at its final point: safe to destroy from its own final awaiter
+
+    if (error)
+    {
+        try
+        {
+            std::rethrow_exception(error);
+        }
+        catch (const std::exception& e)
+        {
+            Utils::Log::Error("Task {} ended with an unhandled exception: {}", root, e.what());
+        }
+        catch (...)
+        {
+            Utils::Log::Error("Task {} ended with an unhandled non-std exception.", root);
+        }
+    }
+}
+
+void TaskHost::Cancel(uint64_t root)
+{
+    auto* found = _roots.Find(root);
+    if (!found)
+        return;
+
+    auto handle = *found;
+    _roots.Remove(root);
+    Destroy(handle);
+}
+
+void TaskHost::CancelAll()
+{
+    std::vector<std::coroutine_handle<>> handles;
+    handles.reserve(_roots.Size());
+    _roots.ForEach([&](std::coroutine_handle<>& h) { handles.push_back(h); });
+    _roots.Clear();
+    for (auto h : handles)
+        Destroy(h);
+}
+
+void TaskHost::Destroy(std::coroutine_handle<> handle)
+{
+    // Never destroy a frame while some coroutine is executing: it may be this one, or the caller
+    // may be running inside one of its children.
+    if (_running > 0)
+        _doomed.push_back(handle);
+    else
+        handle.destroy();
+}
+
+}  // namespace CS2Kit::Core
@@ -0,0 +1,191 @@
+#include <CS2Kit/Core/ThreadPool.hpp>
+#include <CS2Kit/Utils/Log.hpp>
+#include <algorithm>
+
+namespace CS2Kit::Core
+{
+
+namespace Log = CS2Kit::Utils::Log;
+
+namespace
+{
+
+// Which pool/worker the current thread is, so work submitted from inside a job stays local.
+thread_local const ThreadPool* t_pool = nullptr;
+thread_local size_t t_workerIndex = 0;
+
+// The game thread is the server's bottleneck; leave it (and one core for the engine's own
+// helpers) alone and never fan out wider than a handful of workers.
+constexpr size_t MaxDefaultThreads = 4;
+
+size_t DefaultThreadCount()
+{
+    const size_t cores = std::thread::hardware_concurrency();
+    return std::clamp<size_t>(cores > 2 ? cores - 2 : 1, 1, MaxDefaultThreads);
+}
+
+}  // namespace
+
+ThreadPool::~ThreadPool()
+{
+    Stop();
+}
+
+void ThreadPool::Start(size_t threads)
+{
+    if (!_workers.empty() || _stopped.load(std::memory_order_relaxed))
+        return;
+
+    const size_t count = threads > 0 ? threads : DefaultThreadCount();
+    _workers.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+        _workers.push_back(std::make_unique<Worker>());
+    // Spawn only once every deque exists: a worker steals from all of them.
+    for (size_t i = 0; i < count; ++i)
+        _workers[i]->Thread = std::thread([this, i] { WorkerMain(i); });
+}
+
+void ThreadPool::Stop()
+{
+    if (_stopped.exchange(true, std::memory_order_relaxed))
+        return;
+
+    {
+        std::lock_guard lock(_sleepMutex);
+        _stopping.store(true, std::memory_order_relaxed);
+    }
+    _wake.notify_all();
+
+    for (auto& worker : _workers)
+        if (worker->Thread.joinable())
+            worker->Thread.join();
+
+    // Workers are gone; whatever they did not pick up is dropped, and finished jobs are
+    // destroyed without running onDone - the state it would touch is going away.
+    for (auto& worker : _workers)
+    {
+        for (Job* job : worker->Jobs)
+            delete job;
+        worker->Jobs.clear();
+    }
+    _queued.store(0, std::memory_order_relaxed);
+    while (Job* job = _completions.Pop())
+        delete job;
+}
+
+void ThreadPool::Submit(std::unique_ptr<Job> job)
+{
+    // Pool work can queue more while Stop is joining; a worker sees _stopping (set before the
+    // join), and drops the job quietly since Log is not for worker threads.
+    const bool onWorker = t_pool == this;
+    if (onWorker ? _stopping.load(std::memory_order_relaxed) : _stopped.load(std::memory_order_relaxed))
+    {
+        if (!onWorker)
+            Log::Warn("ThreadPool: Run after shutdown ignored.");
+        return;
+    }
+    if (_workers.empty())
+        Start();
+
+    const size_t index = onWorker ? t_workerIndex
+                                        : _nextWorker.fetch_add(1, std::memory_order_relaxed) % _workers.size();
+    {
+        // Counted under the deque lock that the taker also holds, so _queued never underflows.
+        std::lock_guard lock(_workers[index]->Mutex);
+        _workers[index]->Jobs.push_back(job.release());
+        _queued.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Taking the sleep lock orders this wake-up after a worker's predicate check, so a worker
+    // about to sleep cannot miss it.
+    {
+        std::lock_guard lock(_sleepMutex);
+    }
+    _wake.notify_one();
+}
+
+ThreadPool::Job* ThreadPool::TakeJob(size_t index)
+{
+    {
+        auto& own = *_workers[index];
+        std::lock_guard lock(own.Mutex);
+        if (!own.Jobs.empty())
+        {
+            Job* job = own.Jobs.back();  // newest first: its data is still warm in this core's cache
+            own.Jobs.pop_back();
+            _queued.fetch_sub(1, std::memory_order_relaxed);
+            return job;
+        }
+    }
+
+    for (size_t offset = 1; offset < _workers.size(); ++offset)
+    {
+        auto& victim = *_workers[(index + offset) % _workers.size()];
+        std::lock_guard lock(victim.Mutex);
+        if (!victim.Jobs.empty())
+        {
+            Job* job = victim.Jobs.front();  // oldest: least likely to be contended by its owner
+            victim.Jobs.pop_front();
+            _queued.fetch_sub(1, std::memory_order_relaxed);
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+void ThreadPool::WorkerMain(size_t index)
+{
+    t_pool = this;
+    t_workerIndex = index;
+
+    while (!_stopping.load(std::memory_order_relaxed))
+    {
+        Job* job = TakeJob(index);
+        if (!job)
+        {
+            std::unique_lock lock(_sleepMutex);
+            _wake.wait(lock, [this] {
+                return _stopping.load(std::memory_order_relaxed) || _queued.load(std::memory_order_relaxed) > 0;
+            });
+            continue;
+        }
+
+        try
+        {
+            job->Execute();
+        }
+        catch (...)
+        {
+            job->Error = std::current_exception();
+        }
+        _completions.Push(job);
+    }
+}
+
+void ThreadPool::DispatchCompletions()
+{
+    while (Job* raw = _completions.Pop())
+    {
+        std::unique_ptr<Job> job(raw);
+        ++_completed;
+        if (job->Error)
+        {
+            try
+            {
+                std::rethrow_exception(job->Error);
+            }
+            catch (const std::exception& e)
+            {
+                Log::Error("ThreadPool: job threw: {}", e.what());
+            }
+            catch (...)
+            {
+                Log::Error("ThreadPool: job threw a non-std exception.");
+            }
+            continue;
+        }
+        job->Complete();
+    }
+}
+
+}  // namespace CS2Kit::Core
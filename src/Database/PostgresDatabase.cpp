@@ -3,6 +3,7 @@
 #include <CS2Kit/Database/PostgresDatabase.hpp>
 #include <CS2Kit/Utils/Log.hpp>
 #include <format>
+#include <optional>
 
 namespace CS2Kit::Database
 {
@@ -86,6 +87,18 @@ void PostgresDatabase::Exec(std::string name, std::string sql, pqxx::params para
     Enqueue({.Name = std::move(name), .Sql = std::move(sql), .Params = std::move(params)});
 }
 
+void PostgresDatabase::QueryAwaiter::Send(Core::ResumeToken token)
+{
+    // Dropped unrun if the task was cancelled meanwhile; otherwise this awaiter still lives in
+    // the suspended frame.
+    _db.Query(std::move(_name), std::move(_sql), std::move(_params), [this, token](DbResult<pqxx::result> result) {
+        if (!token.Alive())
+            return;
+        _result = std::move(result);
+        token();
+    });
+}
+
 DbResult<pqxx::result> PostgresDatabase::QueryBlocking(const std::string& name, const std::string& sql,
                                                        pqxx::params params)
 {
@@ -128,8 +141,14 @@ void PostgresDatabase::DispatchCompletions()
         std::lock_guard lock(_completionMutex);
         ready.swap(_completions);
     }
+    auto* engine = Core::EngineOrNull();
     for (auto& [callback, result] : ready)
+    {
+        std::optional<Core::ProfileScope> scope;
+        if (engine)
+            scope.emplace(engine->Profiler, _probe);
         callback(std::move(result));
+    }
 }
 
 void PostgresDatabase::Enqueue(Job job)
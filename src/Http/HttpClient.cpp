@@ -1,7 +1,9 @@
+#include <CS2Kit/Core/Services.hpp>
 #include <CS2Kit/Http/HttpClient.hpp>
 #include <chrono>
 #include <cpr/cpr.h>
 #include <future>
+#include <optional>
 #include <utility>
 
 namespace CS2Kit::Http
@@ -53,6 +55,7 @@ struct HttpClient::Impl
     };
 
     std::vector<Pending> Items;
+    Core::ProbePoint Probe{"http.completion"};
 };
 
 HttpClient::HttpClient() : _impl(std::make_unique<Impl>()) {}
@@ -95,6 +98,22 @@ void HttpClient::Get(std::string url, std::vector<std::string> headers, long tim
     _impl->Items.push_back({std::async(std::launch::async, std::move(task)), std::move(onComplete)});
 }
 
+void HttpClient::Awaiter::Send(Core::ResumeToken token)
+{
+    // The completion outlives nothing it touches: a cancelled task fails Alive() and the result is
+    // dropped, otherwise the awaiter is still parked in the suspended frame.
+    auto onComplete = [this, token](const HttpResult& result) {
+        if (!token.Alive())
+            return;
+        _result = result;
+        token();
+    };
+    if (_post)
+        _client.Post(std::move(_url), std::move(_body), std::move(_headers), _timeoutMs, std::move(onComplete));
+    else
+        _client.Get(std::move(_url), std::move(_headers), _timeoutMs, std::move(onComplete));
+}
+
 void HttpClient::DispatchCompletions()
 {
     auto& items = _impl->Items;
@@ -115,10 +134,15 @@ void HttpClient::DispatchCompletions()
         }
     }
 
+    auto* engine = Core::EngineOrNull();
     for (auto& p : ready)
     {
-        if (p.OnComplete)
-            p.OnComplete(p.Result.get());
+        if (!p.OnComplete)
+            continue;
+        std::optional<Core::ProfileScope> scope;
+        if (engine)
+            scope.emplace(engine->Profiler, _impl->Probe);
+        p.OnComplete(p.Result.get());
     }
 }
 
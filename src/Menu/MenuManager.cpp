@@ -177,13 +177,14 @@ bool MenuManager::HasActiveMenu(int slot) const
 
 void MenuManager::OnGameFrame()
 {
+    Core::ProfileScope scope(Engine().Profiler, _probe);
     for (int slot = 0; slot < Core::MaxPlayers; ++slot)
     {
         auto& state = _states[slot];
         if (!state.HasMenu())
             continue;
 
-        uint64_t buttons = Engine().Entities.GetPlayerButtons(slot);
+        uint64_t buttons = Engine().Snapshot.Buttons(slot);
         auto prev = state.PrevButtons;
         state.PrevButtons = buttons;
 
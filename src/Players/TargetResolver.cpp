@@ -1,7 +1,6 @@
 #include <CS2Kit/Core/Services.hpp>
 #include <CS2Kit/Players/PlayerManager.hpp>
 #include <CS2Kit/Players/TargetResolver.hpp>
-#include <CS2Kit/Sdk/PlayerController.hpp>
 #include <random>
 
 namespace CS2Kit::Players
@@ -18,18 +17,20 @@ std::expected<std::vector<Player*>, TargetFailure> ResolveTargets(std::string_vi
     const CanTargetFn& policy = canTarget ? canTarget : Core::Engine().Policy.CanTarget;
 
     // Snapshot the roster into engine-free views; FilterRoster owns the grammar semantics.
+    auto& snapshot = Core::Engine().Snapshot;
     std::vector<PlayerView> roster;
     for (auto* p : mgr.GetAllPlayers())
     {
         if (!p)
             continue;
-        Sdk::PlayerController ctrl = p->Controller();
+        int slot = p->GetSlot();
+        bool valid = snapshot.Controller(slot) != nullptr;
         roster.push_back({
-            .Slot = p->GetSlot(),
+            .Slot = slot,
             .SteamId = p->GetSteamID(),
             .Name = p->GetName(),
-            .Team = ctrl.IsValid() ? ctrl.GetTeam() : 0,
-            .Alive = ctrl.IsValid() && ctrl.IsAlive(),
+            .Team = valid ? snapshot.Team(slot) : 0,
+            .Alive = valid && snapshot.Alive(slot),
             .Bot = p->GetSteamID() == 0,  // bots have no real SteamID
             .Targetable = (caller && policy) ? policy(*caller, *p) : true,
         });
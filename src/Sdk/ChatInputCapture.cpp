@@ -8,7 +8,8 @@ using CS2Kit::Core::Engine;
 namespace CS2Kit::Sdk
 {
 
-void ChatInputCapture::BeginCapture(int slot, std::string prompt, Callback callback, int timeoutMs)
+void ChatInputCapture::BeginCapture(int slot, std::string prompt, Callback callback, int timeoutMs,
+                                    CancelCallback onCancel)
 {
     if (!Core::IsValidSlot(slot) || !callback)
         return;
@@ -18,7 +19,9 @@ void ChatInputCapture::BeginCapture(int slot, std::string prompt, Callback callb
     Pending p{
         .Prompt = std::move(prompt),
         .Cb = std::move(callback),
+        .OnCancel = std::move(onCancel),
         .TimeoutHandle = 0,
+        .Id = ++_nextId,
     };
 
     if (timeoutMs > 0)
@@ -55,6 +58,10 @@ bool ChatInputCapture::TryConsume(int slot, std::string_view text)
             Engine().Scheduler.Cancel(timeoutHandle);
         opt.reset();
     }
+    else if (!opt.has_value())
+    {
+        return false;  // the validator dropped its own capture: this line is ordinary chat
+    }
     // Either way we suppress the chat broadcast - the player typed a value, not a chat message.
     return true;
 }
@@ -71,7 +78,51 @@ void ChatInputCapture::CancelCapture(int slot)
     if (opt->TimeoutHandle != 0)
         Engine().Scheduler.Cancel(opt->TimeoutHandle);
 
+    auto onCancel = std::move(opt->OnCancel);
     opt.reset();
+    if (onCancel)
+        onCancel(slot);
+}
+
+bool ChatInputCapture::ReadAwaiter::Send(Core::ResumeToken token)
+{
+    if (!Core::IsValidSlot(_slot))
+        return false;  // nothing to wait for: resume at once with nullopt
+
+    // Both paths resume on the next frame rather than inline, so the task never runs inside
+    // TryConsume / CancelCapture while they are still touching _pending.
+    _capture.BeginCapture(
+        _slot, std::move(_prompt),
+        [this, token, &capture = _capture](int slot, std::string_view text) {
+            // A cancelled task whose frame is not destroyed yet: release the player, don't swallow the line.
+            if (!token.Alive())
+            {
+                capture.CancelCapture(slot);
+                return false;
+            }
+            _result.emplace(text);
+            Engine().Scheduler.NextTick(token);
+            return true;
+        },
+        _timeoutMs,
+        [token](int) {
+            if (token.Alive())
+                Engine().Scheduler.NextTick(token);
+        });
+    _captureId = _capture._pending[_slot]->Id;
+    return true;
+}
+
+ChatInputCapture::ReadAwaiter::~ReadAwaiter()
+{
+    // Runs on every exit, normal resumes included. By then the capture has usually ended, or the
+    // slot holds someone else's, so only a capture that is still this awaiter's is cancelled.
+    // Without an active Services (a failed load tearing down), everything here is going away anyway.
+    if (_captureId == 0 || !Core::EngineOrNull())
+        return;
+    const auto& pending = _capture._pending[_slot];
+    if (pending.has_value() && pending->Id == _captureId)
+        _capture.CancelCapture(_slot);
 }
 
 const std::string* ChatInputCapture::GetPrompt(int slot) const
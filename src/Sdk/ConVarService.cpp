@@ -237,10 +237,7 @@ void ConVarService::RemoveChangeListener(uint64_t id)
 
 void ConVarService::DispatchChange(const char* name, const char* oldValue, const char* newValue)
 {
-    for (const auto& [id, callback] : _changeCallbacks.Items())
-    {
-        callback(name, oldValue, newValue);
-    }
+    _changeCallbacks.ForEach([&](ChangeCallback& callback) { callback(name, oldValue, newValue); });
 }
 
 }  // namespace CS2Kit::Sdk
@@ -1,10 +1,9 @@
-#include "Sdk/Schema.hpp"
 
 #include <CS2Kit/Core/Services.hpp>
 #include <CS2Kit/Sdk/EffectOps.hpp>
 #include <CS2Kit/Sdk/EntityKeyValues.hpp>
 #include <CS2Kit/Sdk/EntityOps.hpp>
-#include <CS2Kit/Sdk/MemoryAccess.hpp>
+#include <CS2Kit/Sdk/SchemaField.hpp>
 #include <Color.h>
 #include <mathlib/vector.h>
 
@@ -13,6 +12,13 @@ using CS2Kit::Core::Engine;
 namespace CS2Kit::Sdk::EffectOps
 {
 
+namespace
+{
+using BeamWidth = SchemaField<"CBeam", "m_fWidth", float>;
+using BeamEndPos = SchemaField<"CBeam", "m_vecEndPos", Vector>;
+using BeamColor = SchemaField<"CBaseModelEntity", "m_clrRender", Color>;
+}  // namespace
+
 CEntityInstance* SpawnParticle(const char* effectName, const Vector& origin, float lifetimeSeconds)
 {
     auto& ops = Engine().EntityOps;
@@ -49,17 +55,9 @@ CEntityInstance* SpawnBeam(const Vector& from, const Vector& to, const Color& co
 
     // Endpoint/width/color live in schema fields with no spawn keyvalue; written
     // before DispatchSpawn they go out with the first network snapshot.
-    auto& schema = Engine().Schema();
-    int offsetWidth = schema.GetOffset("CBeam", "m_fWidth");
-    int offsetEndPos = schema.GetOffset("CBeam", "m_vecEndPos");
-    int offsetColor = schema.GetOffset("CBaseModelEntity", "m_clrRender");
-
-    if (offsetWidth >= 0)
-        WriteAt<float>(beam, offsetWidth, width);
-    if (offsetEndPos >= 0)
-        WriteAt<Vector>(beam, offsetEndPos, to);
-    if (offsetColor >= 0)
-        WriteAt<Color>(beam, offsetColor, color);
+    BeamWidth::Set(beam, width);
+    BeamEndPos::Set(beam, to);
+    BeamColor::Set(beam, color);
 
     EntityKeyValues kv;
     kv.Set("origin", from);
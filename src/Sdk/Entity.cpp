@@ -1,4 +1,4 @@
-#include "Sdk/Schema.hpp"
+#include "Sdk/SchemaFields.hpp"
 
 #include <CS2Kit/Core/Services.hpp>
 #include <CS2Kit/Sdk/Entity.hpp>
@@ -7,6 +7,7 @@
 #include <CS2Kit/Sdk/MemoryAccess.hpp>
 #include <CS2Kit/Utils/Log.hpp>
 #include <bit>
+#include <cstddef>
 #include <entity2/concreteentitylist.h>
 #include <entity2/entityidentity.h>
 #include <entity2/entityinstance.h>
@@ -26,29 +27,49 @@ namespace CS2Kit::Sdk
 {
 using namespace CS2Kit::Utils;
 
-int EntitySystem::GetEntityIndex(CEntityInstance* entity) const
+namespace
 {
-    return (entity && entity->m_pEntity) ? entity->m_pEntity->GetEntityIndex().Get() : -1;
-}
-
-uint32_t EntitySystem::GetEntityHandle(CEntityInstance* entity) const
+const char* DesignerName(CEntityIdentity* identity)
 {
-    return (entity && entity->m_pEntity) ? static_cast<uint32_t>(entity->m_pEntity->m_EHandle.ToInt()) : 0xFFFFFFFFu;
+    return identity ? identity->m_designerName.String() : nullptr;
 }
 
-void EntitySystem::ResolveSchemaOffsets()
+const IdentityLayout SdkIdentityLayout{
+    .Stride = sizeof(CEntityIdentity),
+    .InstanceOffset = static_cast<int>(offsetof(CEntityIdentity, m_pInstance)),
+    .HandleOffset = static_cast<int>(offsetof(CEntityIdentity, m_EHandle)),
+    .NameOffset = static_cast<int>(offsetof(CEntityIdentity, m_designerName)),
+};
+}  // namespace
+
+// Forwards the engine's entity notifications to the owning EntitySystem.
+class EntitySystem::Listener final : public IEntityListener
 {
-    if (_schemaOffsetsResolved)
-        return;
+public:
+    explicit Listener(EntitySystem& owner) : _owner(owner) {}
+
+    void OnEntityCreated(CEntityInstance* entity) override { _owner.OnEntityCreated(entity); }
+    void OnEntityDeleted(CEntityInstance* entity) override { _owner.OnEntityDeleted(entity); }
 
-    auto& schema = Engine().Schema();
+private:
+    EntitySystem& _owner;
+};
 
-    _offsetPlayerPawn = schema.GetOffset("CBasePlayerController", "m_hPawn");
-    _offsetMovementServices = schema.GetOffset("CBasePlayerPawn", "m_pMovementServices");
-    _offsetButtons = schema.GetOffset("CPlayer_MovementServices", "m_nButtons");
-    _offsetButtonStates = schema.GetOffset("CInButtonState", "m_pButtonStates");
+EntitySystem::EntitySystem() = default;
+
+EntitySystem::~EntitySystem()
+{
+    Shutdown();
+}
 
-    _schemaOffsetsResolved = true;
+int EntitySystem::GetEntityIndex(CEntityInstance* entity) const
+{
+    return (entity && entity->m_pEntity) ? entity->m_pEntity->GetEntityIndex().Get() : -1;
+}
+
+uint32_t EntitySystem::GetEntityHandle(CEntityInstance* entity) const
+{
+    return (entity && entity->m_pEntity) ? static_cast<uint32_t>(entity->m_pEntity->m_EHandle.ToInt()) : 0xFFFFFFFFu;
 }
 
 CGameEntitySystem* EntitySystem::ReadEntitySystemPointer()
@@ -90,11 +111,77 @@ bool EntitySystem::Initialize()
     if (interfaces.EntitySystem)
     {
         Log::Info("Entity system initialized.");
+        AttachListener();  // late load: a map is already running
     }
 
     return true;
 }
 
+void EntitySystem::OnServerStartup()
+{
+    // Each map gets a fresh CGameEntitySystem; the one the listener was on is gone, together
+    // with our entry in it. The new one may reuse its address, so forget it rather than compare.
+    _listenerSystem = nullptr;
+    _classIndex.Clear();
+    Engine().Interfaces.EntitySystem = ReadEntitySystemPointer();
+    AttachListener();
+}
+
+void EntitySystem::Shutdown()
+{
+    // Detach only from the system the engine is running now, read fresh rather than from the
+    // cached interface. If that is a new system at the old address, it does not hold our entry
+    // and RemoveListenerEntity finds nothing to remove; a replaced system is never touched.
+    if (_listenerSystem && Core::EngineOrNull() && ReadEntitySystemPointer() == _listenerSystem)
+        _listenerSystem->RemoveListenerEntity(_listener.get());
+    _listenerSystem = nullptr;
+    _classIndex.Clear();
+}
+
+void EntitySystem::AttachListener()
+{
+    auto* pSys = GetEntitySystem();
+    if (!pSys || pSys == _listenerSystem)  // already attached during this map
+        return;
+
+    if (!_listener)
+        _listener = std::make_unique<Listener>(*this);
+    pSys->AddListenerEntity(_listener.get());
+    _listenerSystem = pSys;
+
+    // Entities that already exist were created before the listener could see them.
+    _classIndex.Clear();
+    for (CEntityIdentity* identity = pSys->m_EntityList.m_pFirstActiveEntity; identity; identity = identity->m_pNext)
+    {
+        if (const char* name = DesignerName(identity))
+            _classIndex.Add(identity->GetEntityIndex().Get(), name);
+    }
+    Log::Info("Entity listener attached ({} entities indexed).", _classIndex.Size());
+}
+
+void EntitySystem::OnEntityCreated(CEntityInstance* entity)
+{
+    if (!entity)
+        return;
+    if (const char* name = DesignerName(entity->m_pEntity))
+        _classIndex.Add(GetEntityIndex(entity), name);
+    _created.ForEach([entity](EntityCallback& callback) { callback(entity); });
+}
+
+void EntitySystem::OnEntityDeleted(CEntityInstance* entity)
+{
+    if (!entity)
+        return;
+    _deleted.ForEach([entity](EntityCallback& callback) { callback(entity); });
+    _classIndex.Remove(GetEntityIndex(entity));
+}
+
+void EntitySystem::RemoveEntityListener(uint64_t id)
+{
+    _created.Remove(id);
+    _deleted.Remove(id);
+}
+
 CGameEntitySystem* EntitySystem::GetEntitySystem()
 {
     auto& interfaces = Engine().Interfaces;
@@ -144,6 +231,23 @@ CEntityInstance* EntitySystem::ResolveEntityHandle(uint32_t handle)
     return pIdentity->m_pInstance;
 }
 
+CEntityInstance* EntitySystem::GetEntityByIndex(int index)
+{
+    CEntityIdentity* pIdentity = GetEntityIdentityByIndex(GetEntitySystem(), index);
+    if (!pIdentity || pIdentity->GetEntityIndex().Get() != index)
+        return nullptr;
+    return pIdentity->m_pInstance;
+}
+
+EntityRange EntitySystem::Iterate(const char* designerName)
+{
+    auto* pSys = GetEntitySystem();
+    if (!pSys)
+        return {};
+    return EntityRange(reinterpret_cast<void* const*>(pSys->m_EntityList.m_pIdentityChunks), MAX_ENTITY_LISTS,
+                       MAX_ENTITIES_IN_LIST, SdkIdentityLayout, designerName);
+}
+
 CEntityInstance* EntitySystem::GetPlayerController(int slot)
 {
     auto* pSys = GetEntitySystem();
@@ -160,33 +264,18 @@ CEntityInstance* EntitySystem::GetPlayerController(int slot)
 
 uint64_t EntitySystem::GetPlayerButtons(int slot)
 {
-    auto* pMovementServices = static_cast<uint8_t*>(GetPlayerMovementServices(slot));
-    if (!pMovementServices || _offsetButtons < 0 || _offsetButtonStates < 0)
-        return 0;
-
-    auto* pButtonStates = MemberPtr<uint64_t>(pMovementServices, _offsetButtons + _offsetButtonStates);
-
-    return pButtonStates[0];  // m_pButtonStates is uint64[3]: [0] held, [1] changed, [2] scroll
+    auto* buttons = Fields::MovementButtons::Ptr(GetPlayerMovementServices(slot));
+    return Fields::ButtonStates::Get(buttons)[0];  // [0] held, [1] changed, [2] scroll
 }
 
 void* EntitySystem::GetPlayerMovementServices(int slot)
 {
-    if (!_schemaOffsetsResolved)
-        ResolveSchemaOffsets();
-
-    if (_offsetPlayerPawn < 0 || _offsetMovementServices < 0)
-        return nullptr;
-
     CEntityInstance* pController = GetPlayerController(slot);
     if (!pController)
         return nullptr;
 
-    uint32_t hPawn = ReadAt<uint32_t>(pController, _offsetPlayerPawn);
-    CEntityInstance* pPawn = ResolveEntityHandle(hPawn);
-    if (!pPawn)
-        return nullptr;
-
-    return ReadAt<uint8_t*>(pPawn, _offsetMovementServices);
+    uint32_t hPawn = Fields::ControllerPawn::Get(pController, Fields::InvalidHandle);
+    return Fields::PawnMovementServices::Get(ResolveEntityHandle(hPawn));
 }
 
 bool EntitySystem::IsPlayerSlotValid(int slot)
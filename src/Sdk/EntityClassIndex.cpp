@@ -0,0 +1,83 @@
+#include <CS2Kit/Sdk/EntityClassIndex.hpp>
+#include <iterator>
+
+namespace CS2Kit::Sdk
+{
+
+void EntityClassIndex::Add(int entityIndex, std::string_view className)
+{
+    if (entityIndex < 0)
+        return;
+
+    Remove(entityIndex);
+
+    auto it = _byClass.find(className);
+    if (it == _byClass.end())
+        it = _byClass.emplace(std::string(className), std::vector<int>{}).first;
+
+    auto index = static_cast<size_t>(entityIndex);
+    if (index >= _where.size())
+        _where.resize(index + 1);
+
+    auto& bucket = it->second;
+    _where[index] = {&bucket, static_cast<uint32_t>(bucket.size())};
+    bucket.push_back(entityIndex);
+    ++_size;
+}
+
+void EntityClassIndex::Remove(int entityIndex)
+{
+    if (!Contains(entityIndex))
+        return;
+
+    auto& location = _where[static_cast<size_t>(entityIndex)];
+    auto& bucket = *location.Bucket;
+    int moved = bucket.back();
+    bucket[location.Position] = moved;
+    _where[static_cast<size_t>(moved)].Position = location.Position;
+    bucket.pop_back();
+    location = {};
+    --_size;
+}
+
+void EntityClassIndex::Clear()
+{
+    _byClass.clear();
+    _where.clear();
+    _size = 0;
+}
+
+bool EntityClassIndex::Contains(int entityIndex) const
+{
+    return entityIndex >= 0 && static_cast<size_t>(entityIndex) < _where.size() &&
+           _where[static_cast<size_t>(entityIndex)].Bucket != nullptr;
+}
+
+size_t EntityClassIndex::Count(std::string_view pattern) const
+{
+    size_t count = 0;
+    auto [first, last] = Match(pattern);
+    for (auto it = first; it != last; ++it)
+        count += it->second.size();
+    return count;
+}
+
+std::pair<EntityClassIndex::Buckets::const_iterator, EntityClassIndex::Buckets::const_iterator>
+EntityClassIndex::Match(std::string_view pattern) const
+{
+    if (!pattern.ends_with('*'))
+    {
+        auto it = _byClass.find(pattern);
+        return {it, it == _byClass.end() ? it : std::next(it)};
+    }
+
+    // Names sharing a prefix are contiguous in the ordered map.
+    pattern.remove_suffix(1);
+    auto first = _byClass.lower_bound(pattern);
+    auto last = first;
+    while (last != _byClass.end() && std::string_view(last->first).starts_with(pattern))
+        ++last;
+    return {first, last};
+}
+
+}  // namespace CS2Kit::Sdk
@@ -0,0 +1,120 @@
+#include <CS2Kit/Sdk/EntityCommandBuffer.hpp>
+#include <utility>
+
+namespace CS2Kit::Sdk
+{
+
+namespace
+{
+bool SameInput(const EntityCommandBuffer::Input& a, const EntityCommandBuffer::Input& b)
+{
+    return a.Name == b.Name && a.IsFloat == b.IsFloat && (a.IsFloat ? a.Value == b.Value : a.Param == b.Param) &&
+           a.Activator == b.Activator && a.Caller == b.Caller;
+}
+}  // namespace
+
+void EntityCommandBuffer::QueueSpawn(std::string_view className, std::shared_ptr<EntityKeyValues> keyValues,
+                                     SpawnCallback onSpawned)
+{
+    _batch.Spawns.push_back({std::string(className), std::move(keyValues), std::move(onSpawned)});
+}
+
+void EntityCommandBuffer::QueueInput(Input input)
+{
+    if (input.Target == NoEntity)
+        return;
+    if (_removed.contains(input.Target))
+    {
+        ++_batch.Counts.Dropped;
+        return;
+    }
+
+    auto& queued = _inputsByTarget[input.Target];
+    for (uint32_t index : queued)
+    {
+        if (SameInput(_batch.Inputs[index], input))
+        {
+            ++_batch.Counts.Coalesced;
+            return;
+        }
+    }
+    queued.push_back(static_cast<uint32_t>(_batch.Inputs.size()));
+    _batch.Inputs.push_back(std::move(input));
+}
+
+void EntityCommandBuffer::QueueKeyValue(uint32_t target, std::string_view key, std::string_view value)
+{
+    if (target == NoEntity)
+        return;
+    if (_removed.contains(target))
+    {
+        ++_batch.Counts.Dropped;
+        return;
+    }
+
+    auto& queued = _keyValuesByTarget[target];
+    for (uint32_t index : queued)
+    {
+        auto& existing = _batch.KeyValues[index];
+        if (existing.Key == key)
+        {
+            existing.Value = value;
+            ++_batch.Counts.Coalesced;
+            return;
+        }
+    }
+    queued.push_back(static_cast<uint32_t>(_batch.KeyValues.size()));
+    _batch.KeyValues.push_back({target, std::string(key), std::string(value)});
+}
+
+void EntityCommandBuffer::QueueRemove(uint32_t target)
+{
+    if (target == NoEntity || !_removed.insert(target).second)
+        return;
+
+    // Earlier commands for the entity become tombstones; Take compacts them away.
+    if (auto it = _inputsByTarget.find(target); it != _inputsByTarget.end())
+    {
+        for (uint32_t index : it->second)
+            _batch.Inputs[index].Target = NoEntity;
+        _batch.Counts.Dropped += it->second.size();
+        _inputsByTarget.erase(it);
+    }
+    if (auto it = _keyValuesByTarget.find(target); it != _keyValuesByTarget.end())
+    {
+        for (uint32_t index : it->second)
+            _batch.KeyValues[index].Target = NoEntity;
+        _batch.Counts.Dropped += it->second.size();
+        _keyValuesByTarget.erase(it);
+    }
+    _batch.Removals.push_back(target);
+}
+
+size_t EntityCommandBuffer::Pending() const
+{
+    size_t pending = _batch.Spawns.size() + _batch.Removals.size();
+    for (const auto& [target, inputs] : _inputsByTarget)
+        pending += inputs.size();
+    for (const auto& [target, keyValues] : _keyValuesByTarget)
+        pending += keyValues.size();
+    return pending;
+}
+
+EntityCommandBuffer::Batch EntityCommandBuffer::Take()
+{
+    Batch batch = std::move(_batch);
+    _batch = {};
+    _inputsByTarget.clear();
+    _keyValuesByTarget.clear();
+    _removed.clear();
+
+    std::erase_if(batch.Inputs, [](const Input& input) { return input.Target == NoEntity; });
+    std::erase_if(batch.KeyValues, [](const KeyValue& keyValue) { return keyValue.Target == NoEntity; });
+    batch.Counts.Spawns = batch.Spawns.size();
+    batch.Counts.Inputs = batch.Inputs.size();
+    batch.Counts.KeyValues = batch.KeyValues.size();
+    batch.Counts.Removals = batch.Removals.size();
+    return batch;
+}
+
+}  // namespace CS2Kit::Sdk
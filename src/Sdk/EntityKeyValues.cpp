@@ -1,4 +1,5 @@
 #include <CS2Kit/Sdk/EntityKeyValues.hpp>
+#include <CS2Kit/Sdk/EntitySpawnTemplate.hpp>
 #include <Color.h>
 #include <entity2/entitykeyvalues.h>
 #include <mathlib/vector.h>
@@ -8,6 +9,11 @@ namespace CS2Kit::Sdk
 
 EntityKeyValues::EntityKeyValues() : _kv(new CEntityKeyValues()) {}
 
+EntityKeyValues::EntityKeyValues(const EntitySpawnTemplate& tmpl) : EntityKeyValues()
+{
+    Apply(tmpl);
+}
+
 EntityKeyValues::~EntityKeyValues()
 {
     // The refcount starts at 0 and Release() deletes at <= 0, so this frees a
@@ -65,6 +71,40 @@ EntityKeyValues& EntityKeyValues::Set(const char* key, const Color& value)
     return *this;
 }
 
+EntityKeyValues& EntityKeyValues::Apply(const EntitySpawnTemplate& tmpl)
+{
+    using Kind = EntitySpawnTemplate::ValueKind;
+    for (const auto& entry : tmpl.Entries())
+    {
+        const char* key = entry.Key.c_str();
+        switch (entry.Kind)
+        {
+        case Kind::String:
+            Set(key, entry.Text.c_str());
+            break;
+        case Kind::Int:
+            Set(key, entry.Int);
+            break;
+        case Kind::Float:
+            Set(key, entry.Float);
+            break;
+        case Kind::Bool:
+            Set(key, entry.Int != 0);
+            break;
+        case Kind::Vector:
+            Set(key, Vector(entry.Vector.x, entry.Vector.y, entry.Vector.z));
+            break;
+        case Kind::Angles:
+            Set(key, QAngle(entry.Vector.x, entry.Vector.y, entry.Vector.z));
+            break;
+        case Kind::Color:
+            Set(key, Color(entry.Color[0], entry.Color[1], entry.Color[2], entry.Color[3]));
+            break;
+        }
+    }
+    return *this;
+}
+
 CEntityKeyValues* EntityKeyValues::Detach()
 {
     CEntityKeyValues* kv = _kv;
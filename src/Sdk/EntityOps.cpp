@@ -9,6 +9,7 @@
 #include <entity2/entityinstance.h>
 #include <entity2/entitykeyvalues.h>
 #include <entity2/entitysystem.h>
+#include <string>
 #include <variant.h>
 
 using CS2Kit::Core::Engine;
@@ -107,6 +108,8 @@ bool EntityOpsService::Initialize()
             Log::Warn("Entity ops: signature '{}' not resolved; the dependent operation is disabled.", signature.Name);
     }
 
+    _pool.Initialize();
+
     return CanSpawn();
 }
 
@@ -229,4 +232,125 @@ void EntityOpsService::NotifyFieldChanged(CEntityInstance* entity, const char* c
     entity->NetworkStateChanged(NetworkStateChangedData(static_cast<uint32>(offset)));
 }
 
+void EntityOpsService::QueueSpawn(const char* className, std::unique_ptr<EntityKeyValues> kv, SpawnCallback onSpawned)
+{
+    if (!className)
+        return;
+
+    _queue.QueueSpawn(className, std::shared_ptr<EntityKeyValues>(std::move(kv)), std::move(onSpawned));
+}
+
+void EntityOpsService::QueueInput(CEntityInstance* entity, const char* input, const char* param,
+                                  CEntityInstance* activator, CEntityInstance* caller)
+{
+    if (!entity || !input)
+        return;
+
+    auto& entities = Engine().Entities;
+    _queue.QueueInput({.Target = entities.GetEntityHandle(entity),
+                       .Name = input,
+                       .Param = param ? param : "",
+                       .Activator = entities.GetEntityHandle(activator),
+                       .Caller = entities.GetEntityHandle(caller)});
+}
+
+void EntityOpsService::QueueInputFloat(CEntityInstance* entity, const char* input, float value,
+                                       CEntityInstance* activator, CEntityInstance* caller)
+{
+    if (!entity || !input)
+        return;
+
+    auto& entities = Engine().Entities;
+    _queue.QueueInput({.Target = entities.GetEntityHandle(entity),
+                       .Name = input,
+                       .Value = value,
+                       .IsFloat = true,
+                       .Activator = entities.GetEntityHandle(activator),
+                       .Caller = entities.GetEntityHandle(caller)});
+}
+
+void EntityOpsService::QueueKeyValue(CEntityInstance* entity, const char* key, const char* value)
+{
+    if (!entity || !key)
+        return;
+
+    _queue.QueueKeyValue(Engine().Entities.GetEntityHandle(entity), key, value ? value : "");
+}
+
+void EntityOpsService::QueueRemove(CEntityInstance* entity)
+{
+    if (entity)
+        _queue.QueueRemove(Engine().Entities.GetEntityHandle(entity));
+}
+
+void EntityOpsService::Flush(bool doSpawn)
+{
+    if (_queue.Pending() == 0)
+        return;
+
+    Core::ProfileScope scope(Engine().Profiler, _flushProbe);
+    auto batch = _queue.Take();
+    EntityIoCounts counts = batch.Counts;
+
+    // Handles were taken at queue time; whatever the game deleted since then resolves to nullptr.
+    auto& entities = Engine().Entities;
+    auto resolve = [&entities](uint32_t handle)
+    { return handle == EntityCommandBuffer::NoEntity ? nullptr : entities.ResolveEntityHandle(handle); };
+    auto drop = [&counts](uint64_t& kind)
+    {
+        --kind;
+        ++counts.Dropped;
+    };
+
+    for (auto& spawn : batch.Spawns)
+    {
+        CEntityInstance* entity = doSpawn && CanSpawn() ? CreateByName(spawn.ClassName.c_str()) : nullptr;
+        if (entity)
+            DispatchSpawn(entity, spawn.KeyValues.get());
+        else
+            drop(counts.Spawns);
+        if (spawn.OnSpawned)
+            spawn.OnSpawned(entity);
+    }
+
+    std::string keyValue;
+    for (const auto& set : batch.KeyValues)
+    {
+        auto* entity = resolve(set.Target);
+        if (!entity)
+        {
+            drop(counts.KeyValues);
+            continue;
+        }
+        keyValue.assign(set.Key).append(" ").append(set.Value);
+        AcceptInput(entity, "AddOutput", keyValue.c_str());
+    }
+
+    for (const auto& input : batch.Inputs)
+    {
+        auto* entity = resolve(input.Target);
+        if (!entity)
+        {
+            drop(counts.Inputs);
+            continue;
+        }
+        if (input.IsFloat)
+            AcceptInputFloat(entity, input.Name.c_str(), input.Value, resolve(input.Activator), resolve(input.Caller));
+        else
+            AcceptInput(entity, input.Name.c_str(), input.Param.c_str(), resolve(input.Activator),
+                        resolve(input.Caller));
+    }
+
+    for (uint32_t handle : batch.Removals)
+    {
+        if (auto* entity = resolve(handle))
+            Remove(entity);
+        else
+            drop(counts.Removals);
+    }
+
+    _lastFlush = counts;
+    _total += counts;
+}
+
 }  // namespace CS2Kit::Sdk
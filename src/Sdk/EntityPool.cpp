@@ -0,0 +1,126 @@
+#include <CS2Kit/Core/Services.hpp>
+#include <CS2Kit/Sdk/Entity.hpp>
+#include <CS2Kit/Sdk/EntityOps.hpp>
+#include <CS2Kit/Sdk/EntityPool.hpp>
+#include <CS2Kit/Sdk/TransmitFilter.hpp>
+#include <utility>
+
+using CS2Kit::Core::Engine;
+
+namespace CS2Kit::Sdk
+{
+
+namespace
+{
+// kRenderNone and glow off, as "AddOutput" keyvalue writes.
+constexpr const char* ParkedRenderMode = "rendermode 10";
+constexpr const char* ParkedGlowState = "glowstate 0";
+}  // namespace
+
+void EntityPool::Initialize()
+{
+    // The listener lives as long as EntitySystem's registry; Entities.Shutdown detaches the
+    // engine before this service goes away, so no callback can outlive the pool.
+    Engine().Entities.ListenEntityDeleted([this](CEntityInstance* entity) { OnEntityDeleted(entity); });
+}
+
+CEntityInstance* EntityPool::Take(std::string_view kind)
+{
+    auto it = _byKind.find(kind);
+    if (it == _byKind.end())
+        return nullptr;
+
+    auto& parked = it->second;
+    auto& entities = Engine().Entities;
+    while (!parked.empty())
+    {
+        Parked entry = parked.back();
+        parked.pop_back();
+        --_parkedCount;
+
+        if (auto* entity = entities.ResolveEntityHandle(entry.Handle))
+        {
+            ++_reuseCount;
+            return entity;
+        }
+    }
+    return nullptr;
+}
+
+void EntityPool::Park(std::string_view kind, CEntityInstance* entity)
+{
+    if (!entity)
+        return;
+
+    auto& entities = Engine().Entities;
+    auto& ops = Engine().EntityOps;
+    auto& transmit = Engine().Transmit;
+    int index = entities.GetEntityIndex(entity);
+
+    // Whatever filtered it belonged to its last user; an inert entity needs no filtering.
+    transmit.ClearEntityExclusive(index);
+
+    auto it = _byKind.find(kind);
+    if (it == _byKind.end())
+        it = _byKind.emplace(std::string(kind), std::vector<Parked>{}).first;
+    if (it->second.size() >= MaxParkedPerKind)
+    {
+        ops.QueueRemove(entity);
+        return;
+    }
+
+    // Inert on its own rather than hidden by the transmit filter: it stays invisible once the
+    // plugin (and its CheckTransmit hook) is gone, and CheckTransmit keeps its early-out.
+    ops.AcceptInput(entity, "ClearParent");
+    ops.AcceptInput(entity, "AddOutput", ParkedRenderMode);
+    ops.AcceptInput(entity, "AddOutput", ParkedGlowState);
+    it->second.push_back({entities.GetEntityHandle(entity), index});
+    ++_parkedCount;
+}
+
+void EntityPool::Shutdown()
+{
+    // Emptied first: a removal that deletes at once re-enters OnEntityDeleted, which then has
+    // nothing to walk. No frame follows, so the removals cannot be queued.
+    auto byKind = std::exchange(_byKind, {});
+    _parkedCount = 0;
+
+    auto& entities = Engine().Entities;
+    auto& ops = Engine().EntityOps;
+    for (const auto& [kind, parked] : byKind)
+    {
+        for (const auto& entry : parked)
+        {
+            if (auto* entity = entities.ResolveEntityHandle(entry.Handle))
+                ops.Remove(entity);
+        }
+    }
+}
+
+void EntityPool::Clear()
+{
+    _byKind.clear();
+    _parkedCount = 0;
+}
+
+void EntityPool::OnEntityDeleted(CEntityInstance* entity)
+{
+    if (_parkedCount == 0)
+        return;
+
+    int index = Engine().Entities.GetEntityIndex(entity);
+    for (auto& [kind, parked] : _byKind)
+    {
+        for (size_t i = 0; i < parked.size(); ++i)
+        {
+            if (parked[i].Index != index)
+                continue;
+            parked[i] = parked.back();
+            parked.pop_back();
+            --_parkedCount;
+            return;
+        }
+    }
+}
+
+}  // namespace CS2Kit::Sdk
@@ -1,12 +1,9 @@
-#include "Sdk/Schema.hpp"
+#include "Sdk/SchemaFields.hpp"
 
-#include <CS2Kit/Core/Services.hpp>
 #include <CS2Kit/Sdk/EntityRender.hpp>
 #include <CS2Kit/Sdk/MemoryAccess.hpp>
 #include <entity2/entityinstance.h>
 
-using CS2Kit::Core::Engine;
-
 namespace CS2Kit::Sdk
 {
 
@@ -15,18 +12,11 @@ void SetEntityRender(CEntityInstance* entity, RenderMode_t mode, uint32_t color)
     if (!entity)
         return;
 
-    // m_nRenderMode/m_clrRender offsets are fixed by the loaded game binary, so resolve them
-    // once (this runs every disco tick). Cached only on success so an early failed lookup retries.
-    static int modeOffset = -1;
-    static int colorOffset = -1;
+    // Runs every disco tick: both offsets are resolved once and cached by SchemaField.
+    const int modeOffset = Fields::RenderMode::Offset();
+    const int colorOffset = Fields::RenderColor::Offset();
     if (modeOffset < 0 || colorOffset < 0)
-    {
-        auto& schema = Engine().Schema();
-        modeOffset = schema.GetOffset("CBaseModelEntity", "m_nRenderMode");
-        colorOffset = schema.GetOffset("CBaseModelEntity", "m_clrRender");
-        if (modeOffset < 0 || colorOffset < 0)
-            return;
-    }
+        return;
 
     WriteAt<uint8_t>(entity, modeOffset, static_cast<uint8_t>(mode));
     WriteAt<uint32_t>(entity, colorOffset, color);
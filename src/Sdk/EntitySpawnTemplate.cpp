@@ -0,0 +1,65 @@
+#include <CS2Kit/Sdk/EntitySpawnTemplate.hpp>
+#include <algorithm>
+
+namespace CS2Kit::Sdk
+{
+
+EntitySpawnTemplate::Entry& EntitySpawnTemplate::Slot(std::string_view key, ValueKind kind)
+{
+    auto it = std::ranges::find(_entries, key, &Entry::Key);
+    Entry& entry = it != _entries.end() ? *it : _entries.emplace_back();
+    entry = {};
+    entry.Key = key;
+    entry.Kind = kind;
+    return entry;
+}
+
+EntitySpawnTemplate& EntitySpawnTemplate::Set(std::string_view key, const char* value)
+{
+    Slot(key, ValueKind::String).Text = value ? value : "";
+    return *this;
+}
+
+EntitySpawnTemplate& EntitySpawnTemplate::Set(std::string_view key, int value)
+{
+    Slot(key, ValueKind::Int).Int = value;
+    return *this;
+}
+
+EntitySpawnTemplate& EntitySpawnTemplate::Set(std::string_view key, float value)
+{
+    Slot(key, ValueKind::Float).Float = value;
+    return *this;
+}
+
+EntitySpawnTemplate& EntitySpawnTemplate::Set(std::string_view key, bool value)
+{
+    Slot(key, ValueKind::Bool).Int = value ? 1 : 0;
+    return *this;
+}
+
+EntitySpawnTemplate& EntitySpawnTemplate::SetVector(std::string_view key, const Vec3& value)
+{
+    Slot(key, ValueKind::Vector).Vector = value;
+    return *this;
+}
+
+EntitySpawnTemplate& EntitySpawnTemplate::SetAngles(std::string_view key, const Vec3& value)
+{
+    Slot(key, ValueKind::Angles).Vector = value;
+    return *this;
+}
+
+EntitySpawnTemplate& EntitySpawnTemplate::SetColor(std::string_view key, uint8_t r, uint8_t g, uint8_t b, uint8_t a)
+{
+    Slot(key, ValueKind::Color).Color = {r, g, b, a};
+    return *this;
+}
+
+const EntitySpawnTemplate::Entry* EntitySpawnTemplate::Find(std::string_view key) const
+{
+    auto it = std::ranges::find(_entries, key, &Entry::Key);
+    return it != _entries.end() ? &*it : nullptr;
+}
+
+}  // namespace CS2Kit::Sdk
@@ -2,11 +2,13 @@
 
 #include <CS2Kit/Core/Paths.hpp>
 #include <CS2Kit/Sdk/GameData.hpp>
+#include <CS2Kit/Sdk/OffsetCache.hpp>
 #include <CS2Kit/Utils/Log.hpp>
 #include <CS2Kit/Utils/StringUtils.hpp>
 #include <filesystem>
 #include <format>
 #include <fstream>
+#include <map>
 #include <nlohmann/json.hpp>
 #include <string>
 #include <vector>
@@ -111,9 +113,51 @@ void* GameData::ResolveSignature(const std::string& name) const
     return reinterpret_cast<void*>(addr);
 }
 
-void GameData::ResolveAll()
+// The cached match for @p sig, if its module build is unchanged and the pattern still matches there.
+static void* FindCachedMatch(OffsetCache& offsets, const std::string& name, const std::string& library,
+                             const std::string& pattern)
+{
+    auto rva = offsets.FindSignature(library, name);
+    if (!rva)
+        return nullptr;
+
+    const auto base = IdentifyModule(library.c_str()).Base;
+    auto* match = base ? reinterpret_cast<void*>(base + *rva) : nullptr;
+    if (PatternMatchesAt(library.c_str(), match, pattern))
+        return match;
+
+    offsets.ForgetSignature(library, name);
+    return nullptr;
+}
+
+// Fill @p entry from a scan (or cache) result for a signature with rel32 offset @p sigOffset.
+static void FinishEntry(GameData::ResolvedEntry& entry, const ScanResult& scan, int sigOffset)
+{
+    entry.Match = scan.Address;
+    entry.Unique = scan.Unique;
+    if (!scan.Address)
+    {
+        entry.Error = "pattern not found";
+    }
+    else if (sigOffset == 0)
+    {
+        entry.Resolved = scan.Address;
+    }
+    else
+    {
+        auto addr = ResolveRelativeAddress(reinterpret_cast<uintptr_t>(scan.Address) + sigOffset, 0, 4);
+        entry.Resolved = reinterpret_cast<void*>(addr);
+        if (addr == 0)
+            entry.Error = "rel32 resolution failed";
+    }
+}
+
+void GameData::ResolveAll(OffsetCache* offsets)
 {
     _resolved.clear();
+
+    // Cache hits and empty patterns settle here; everything else waits for its library's scan.
+    std::map<std::string, std::vector<const std::string*>> pending;  // library -> signature names
     for (const auto& [name, sig] : _signatures)
     {
         ResolvedEntry entry;
@@ -121,29 +165,50 @@ void GameData::ResolveAll()
         {
             entry.Error = "empty pattern";
         }
+        else if (void* cached = offsets ? FindCachedMatch(*offsets, name, sig.Library, sig.Pattern) : nullptr)
+        {
+            entry.FromCache = true;
+            FinishEntry(entry, {cached, true}, sig.Offset);
+        }
         else
         {
-            auto scan = FindPatternEx(sig.Library.c_str(), sig.Pattern);
-            entry.Match = scan.Address;
-            entry.Unique = scan.Unique;
-            if (!scan.Address)
-            {
-                entry.Error = "pattern not found";
-            }
-            else if (sig.Offset == 0)
-            {
-                entry.Resolved = scan.Address;
-            }
-            else
-            {
-                auto addr = ResolveRelativeAddress(reinterpret_cast<uintptr_t>(scan.Address) + sig.Offset, 0, 4);
-                entry.Resolved = reinterpret_cast<void*>(addr);
-                if (addr == 0)
-                    entry.Error = "rel32 resolution failed";
-            }
+            pending[sig.Library].push_back(&name);
+            continue;
         }
         _resolved[name] = std::move(entry);
     }
+
+    // One walk over each library's segments for all of its remaining signatures.
+    for (const auto& [library, names] : pending)
+    {
+        std::vector<std::string> patterns;
+        patterns.reserve(names.size());
+        for (const auto* name : names)
+            patterns.push_back(_signatures.at(*name).Pattern);
+
+        const auto scans = FindPatternsEx(library.c_str(), patterns);
+        const auto base = offsets ? IdentifyModule(library.c_str()).Base : 0;
+        for (size_t i = 0; i < names.size(); ++i)
+        {
+            const auto& name = *names[i];
+            const auto& scan = scans[i];
+            // Only unique matches are worth remembering; an ambiguous one is rescanned (and reported) each load.
+            if (offsets && scan.Address && scan.Unique)
+                offsets->StoreSignature(library, name, reinterpret_cast<uintptr_t>(scan.Address) - base);
+
+            ResolvedEntry entry;
+            FinishEntry(entry, scan, _signatures.at(name).Offset);
+            _resolved[name] = std::move(entry);
+        }
+    }
+}
+
+size_t GameData::CachedCount() const
+{
+    size_t count = 0;
+    for (const auto& [name, entry] : _resolved)
+        count += entry.FromCache ? 1 : 0;
+    return count;
 }
 
 std::string GameData::FailureSummary() const
@@ -47,7 +47,7 @@ void GameEventService::FreeEvent(IGameEvent* event)
         mgr->FreeEvent(event);
 }
 
-uint64_t GameEventService::Listen(const char* eventName, EventCallback callback)
+uint64_t GameEventService::Listen(const char* eventName, EventCallback callback, std::source_location site)
 {
     auto* mgr = Engine().Interfaces.GameEventManager;
     if (!mgr)
@@ -58,7 +58,7 @@ uint64_t GameEventService::Listen(const char* eventName, EventCallback callback)
     if (_registeredEvents.insert(eventName).second)
         mgr->AddListener(this, eventName, true);
 
-    return _listeners.Add({eventName, std::move(callback)});
+    return _listeners.Add({eventName, std::move(callback), site});
 }
 
 void GameEventService::OnServerStartup()
@@ -104,13 +104,15 @@ void GameEventService::FireGameEvent(IGameEvent* event)
     if (!eventName)
         return;
 
-    for (const auto& [id, listener] : _listeners.Items())
-    {
-        if (listener.EventName == eventName && listener.Callback)
-        {
-            listener.Callback(event);
-        }
-    }
+    auto& profiler = Engine().Profiler;
+    _listeners.ForEach([&](RegisteredListener& listener) {
+        if (listener.EventName != eventName || !listener.Callback)
+            return;
+        if (listener.Probe == 0 && profiler.Active())
+            listener.Probe = profiler.SiteProbe("event " + listener.EventName, listener.Site);
+        Core::ProfileScope scope(&profiler, listener.Probe);
+        listener.Callback(event);
+    });
 }
 
 }  // namespace CS2Kit::Sdk
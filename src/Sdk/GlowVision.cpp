@@ -1,9 +1,11 @@
 #include <CS2Kit/Core/Services.hpp>
 #include <CS2Kit/Sdk/EntityKeyValues.hpp>
 #include <CS2Kit/Sdk/EntityOps.hpp>
+#include <CS2Kit/Sdk/EntitySpawnTemplate.hpp>
 #include <CS2Kit/Sdk/GlowVision.hpp>
 #include <CS2Kit/Sdk/PawnOps.hpp>
-#include <CS2Kit/Sdk/PlayerController.hpp>
+#include <CS2Kit/Sdk/PawnView.hpp>
+#include <format>
 #include <utility>
 
 using CS2Kit::Core::Engine;
@@ -23,6 +25,57 @@ constexpr int GlowTeamAny = -1;
 constexpr int GlowStateAlwaysOn = 3;
 constexpr int GlowRenderAmt = 1;
 
+constexpr std::string_view RelayKind = "glowvision.relay";
+
+const EntitySpawnTemplate& RelayTemplate()
+{
+    static const EntitySpawnTemplate relay =
+        EntitySpawnTemplate("prop_dynamic").Set("spawnflags", PropSpawnFlags).Set("rendermode", RenderModeNone);
+    return relay;
+}
+
+// Only the model and glow color differ per clone; both are set per spawn.
+const EntitySpawnTemplate& GlowTemplate()
+{
+    static const EntitySpawnTemplate glow = EntitySpawnTemplate("prop_dynamic")
+                                                .Set("spawnflags", PropSpawnFlags)
+                                                .Set("glowrange", GlowRangeUnits)
+                                                .Set("glowteam", GlowTeamAny)
+                                                .Set("glowstate", GlowStateAlwaysOn)
+                                                .Set("renderamt", GlowRenderAmt);
+    return glow;
+}
+
+// The glow color is baked in at spawn, so pooled glow clones are only interchangeable per color.
+std::string GlowKind(const Color& color)
+{
+    return std::format("glowvision.glow.{}.{}.{}.{}", color.r(), color.g(), color.b(), color.a());
+}
+
+// A pooled clone of the right kind when one is parked, else a fresh spawn from the template.
+CEntityInstance* AcquireClone(std::string_view kind, const EntitySpawnTemplate& tmpl, const std::string& model,
+                              const Color* glowColor = nullptr)
+{
+    auto& ops = Engine().EntityOps;
+    if (auto* reused = ops.Pool().Take(kind))
+    {
+        ops.SetModel(reused, model.c_str());
+        // Parking left it inert; restore the render mode and glow state it spawned with.
+        for (const char* key : {"rendermode", "glowstate"})
+        {
+            const auto* entry = tmpl.Find(key);
+            ops.AcceptInput(reused, "AddOutput", std::format("{} {}", key, entry ? entry->Int : 0).c_str());
+        }
+        return reused;
+    }
+
+    EntityKeyValues kv(tmpl);
+    kv.Set("model", model.c_str());
+    if (glowColor)
+        kv.Set("glowcolor", *glowColor);
+    return ops.Spawn(tmpl.ClassName().c_str(), kv);
+}
+
 }  // namespace
 
 void GlowVision::DestroyPair(GlowPair& pair)
@@ -30,51 +83,46 @@ void GlowVision::DestroyPair(GlowPair& pair)
     if (!pair.Active())
         return;
 
-    // Unregister before removal: a recycled index still registered would filter
-    // whatever entity the engine hands that index to next.
+    // Unregister first: a recycled index still registered would filter whatever entity the
+    // engine hands that index to next. Parking turns the clones' rendering and glow off.
     auto& transmit = Engine().Transmit;
     transmit.ClearEntityExclusive(pair.RelayIndex);
     transmit.ClearEntityExclusive(pair.GlowIndex);
 
     auto& ops = Engine().EntityOps;
     auto& entities = Engine().Entities;
+    // Parked rather than removed: team/model changes and respawns take them straight back.
     if (auto* glow = entities.ResolveEntityHandle(pair.GlowHandle))
-        ops.Remove(glow);
+        ops.Pool().Park(pair.GlowKind, glow);
     if (auto* relay = entities.ResolveEntityHandle(pair.RelayHandle))
-        ops.Remove(relay);
+        ops.Pool().Park(RelayKind, relay);
 
     pair = {};
 }
 
 void GlowVision::CreatePair(int slot, GlowPair& pair)
 {
-    PlayerController pc(slot);
-    auto* pawn = pc.GetPawn();
-    std::string model = pc.GetPawnModelName();
-    int team = pc.GetTeam();
-    if (!pawn || model.empty())
+    auto& snapshot = Engine().Snapshot;
+    auto* pawn = snapshot.Pawn(slot);
+    if (!pawn)
+        return;
+    std::string model = PawnView(pawn).GetModelName();
+    int team = snapshot.Team(slot);
+    if (model.empty())
         return;
 
     auto& ops = Engine().EntityOps;
 
-    EntityKeyValues relayKv;
-    relayKv.Set("model", model.c_str()).Set("spawnflags", PropSpawnFlags).Set("rendermode", RenderModeNone);
-    auto* relay = ops.Spawn("prop_dynamic", relayKv);
+    auto* relay = AcquireClone(RelayKind, RelayTemplate(), model);
     if (!relay)
         return;
 
-    EntityKeyValues glowKv;
-    glowKv.Set("model", model.c_str())
-        .Set("spawnflags", PropSpawnFlags)
-        .Set("glowcolor", team == TeamT ? _config.TerroristColor : _config.CtColor)
-        .Set("glowrange", GlowRangeUnits)
-        .Set("glowteam", GlowTeamAny)
-        .Set("glowstate", GlowStateAlwaysOn)
-        .Set("renderamt", GlowRenderAmt);
-    auto* glow = ops.Spawn("prop_dynamic", glowKv);
+    const Color& color = team == TeamT ? _config.TerroristColor : _config.CtColor;
+    std::string glowKind = GlowKind(color);
+    auto* glow = AcquireClone(glowKind, GlowTemplate(), model, &color);
     if (!glow)
     {
-        ops.Remove(relay);
+        ops.Pool().Park(RelayKind, relay);
         return;
     }
 
@@ -88,6 +136,7 @@ void GlowVision::CreatePair(int slot, GlowPair& pair)
     pair.GlowIndex = entities.GetEntityIndex(glow);
     pair.Team = team;
     pair.Model = std::move(model);
+    pair.GlowKind = std::move(glowKind);
 
     auto& transmit = Engine().Transmit;
     transmit.SetEntityExclusive(pair.RelayIndex, _beneficiarySlot);
@@ -96,21 +145,23 @@ void GlowVision::CreatePair(int slot, GlowPair& pair)
 
 void GlowVision::Reconcile()
 {
+    auto& snapshot = Engine().Snapshot;
     for (int slot = 0; slot < MaxPlayers; ++slot)
     {
         auto& pair = _pairs[slot];
 
-        PlayerController pc(slot);
-        int team = pc.GetTeam();
+        int team = snapshot.Team(slot);
         // Ghosted pawns never transmit to the beneficiary, so a clone would follow nothing.
-        bool desired = slot != _beneficiarySlot && pc.IsValid() && pc.IsAlive() && (team == TeamT || team == TeamCT) &&
-                       !Engine().Transmit.IsPawnHidden(slot) && (!_config.Filter || _config.Filter(slot));
+        bool desired = slot != _beneficiarySlot && snapshot.Controller(slot) && snapshot.Alive(slot) &&
+                       (team == TeamT || team == TeamCT) && !Engine().Transmit.IsPawnHidden(slot) &&
+                       (!_config.Filter || _config.Filter(slot));
 
         if (pair.Active())
         {
             auto& entities = Engine().Entities;
             bool stale = !desired || team != pair.Team || !entities.ResolveEntityHandle(pair.RelayHandle) ||
-                         !entities.ResolveEntityHandle(pair.GlowHandle) || pc.GetPawnModelName() != pair.Model;
+                         !entities.ResolveEntityHandle(pair.GlowHandle) ||
+                         PawnView(snapshot.Pawn(slot)).GetModelName() != pair.Model;
             if (stale)
                 DestroyPair(pair);
         }
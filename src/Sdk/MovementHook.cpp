@@ -68,6 +68,7 @@ void MovementHook::Remove()
 
     _installed = false;
     _vtable = nullptr;
+    _slotIndex.Clear();
 }
 
 void MovementHook::RemoveListener(uint64_t id)
@@ -81,15 +82,9 @@ void MovementHook::RemoveListener(uint64_t id)
 
 int MovementHook::SlotFromMovementServices(void* movementServices) const
 {
-    if (!movementServices)
-        return -1;
-
-    auto& entities = Engine().Entities;
-    for (int slot = 0; slot < Core::MaxPlayers; ++slot)
-        if (entities.GetPlayerMovementServices(slot) == movementServices)
-            return slot;
-
-    return -1;
+    auto& snapshot = Engine().Snapshot;
+    return _slotIndex.Find(movementServices, snapshot.Frame(),
+                           [&snapshot](int slot) { return snapshot.MovementServices(slot); });
 }
 
 void MovementHook::DecodeUserCmd(void* userCmd)
@@ -152,17 +147,15 @@ void MovementHook::DecodeUserCmd(void* userCmd)
 
 void* MovementHook::Hook_RunCommandPre(void* userCmd)
 {
+    Core::ProfileScope scope(Engine().Profiler, _preProbe);
     _preSlot = SlotFromMovementServices(META_IFACEPTR(void));
     if (!_preCmd.Empty() || !_postCmd.Empty() || !_filter.Empty())
         DecodeUserCmd(userCmd);
     // Filters edit the decoded view before anyone reads it, so pre/preCmd/postCmd listeners
     // and InputHistory all observe the same edited command.
-    for (const auto& [id, filter] : _filter.Items())
-        filter(_preSlot, _cmdView);
-    for (const auto& [id, callback] : _pre.Items())
-        callback(_preSlot);
-    for (const auto& [id, callback] : _preCmd.Items())
-        callback(_preSlot, _cmdView);
+    _filter.ForEach([this](CmdFilter& filter) { filter(_preSlot, _cmdView); });
+    _pre.ForEach([this](Callback& callback) { callback(_preSlot); });
+    _preCmd.ForEach([this](CmdCallback& callback) { callback(_preSlot, _cmdView); });
     RETURN_META_VALUE(MRES_IGNORED, nullptr);
 }
 
@@ -171,10 +164,9 @@ void* MovementHook::Hook_RunCommandPost(void* /*userCmd*/)
     // Post always brackets the same RunCommand call as the preceding pre (movement is
     // processed one player at a time, no nesting), so reuse the pre-resolved slot and
     // the pre-decoded cmd view rather than repeating the work.
-    for (const auto& [id, callback] : _post.Items())
-        callback(_preSlot);
-    for (const auto& [id, callback] : _postCmd.Items())
-        callback(_preSlot, _cmdView);
+    Core::ProfileScope scope(Engine().Profiler, _postProbe);
+    _post.ForEach([this](Callback& callback) { callback(_preSlot); });
+    _postCmd.ForEach([this](CmdCallback& callback) { callback(_preSlot, _cmdView); });
     RETURN_META_VALUE(MRES_IGNORED, nullptr);
 }
 
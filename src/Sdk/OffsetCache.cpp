@@ -0,0 +1,216 @@
+#include "Sdk/SigScanner.hpp"
+
+#include <CS2Kit/Sdk/OffsetCache.hpp>
+#include <CS2Kit/Utils/Log.hpp>
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include <utility>
+
+namespace CS2Kit::Sdk
+{
+
+using namespace CS2Kit::Utils;
+
+OffsetCache::OffsetCache(ModuleIdentifier identify) : _identify(std::move(identify))
+{
+    if (!_identify)
+        _identify = [](std::string_view module) { return IdentifyModule(std::string(module).c_str()).BuildId; };
+}
+
+std::string OffsetCache::FieldKey(std::string_view className, std::string_view fieldName)
+{
+    std::string key;
+    key.reserve(className.size() + 2 + fieldName.size());
+    key.append(className).append("::").append(fieldName);
+    return key;
+}
+
+const std::string& OffsetCache::BuildIdOf(std::string_view module)
+{
+    auto it = _modules.find(module);
+    if (it == _modules.end())
+        it = _modules.emplace(std::string(module), ModuleEntries{.BuildId = _identify(module)}).first;
+    return it->second.BuildId;
+}
+
+bool OffsetCache::Load(const std::filesystem::path& path)
+{
+    _modules.clear();
+    _fields.clear();
+    _dirty = false;
+    _staleModules = 0;
+
+    std::ifstream file(path);
+    if (!file.is_open())
+        return false;
+
+    try
+    {
+        auto json = nlohmann::json::parse(file);
+        if (json.value("version", 0) != FormatVersion)
+        {
+            _dirty = true;  // rewrite in the current format
+            return false;
+        }
+
+        bool schemaValid = false;
+        for (auto& [module, entry] : json["modules"].items())
+        {
+            const auto stored = entry.value("build", std::string{});
+            const auto& current = BuildIdOf(module);
+            if (stored.empty() || stored != current)
+            {
+                ++_staleModules;
+                _dirty = true;
+                continue;
+            }
+            if (module == SchemaModule)
+                schemaValid = true;
+            auto& signatures = _modules[module].Signatures;
+            for (auto& [name, rva] : entry["signatures"].items())
+                signatures[name] = rva.get<uint64_t>();
+        }
+
+        if (schemaValid && json.contains("schema"))
+        {
+            for (auto& [key, field] : json["schema"].items())
+            {
+                const Field entry{.Offset = field.at(0).get<int>(), .Size = field.at(1).get<int>()};
+                if (entry.Offset < 0 || entry.Size < 0)
+                {
+                    _dirty = true;  // cannot be a real field; drop it so the next save heals the file
+                    continue;
+                }
+                _fields[key] = entry;
+            }
+        }
+        else if (json.contains("schema"))
+        {
+            _dirty = true;
+        }
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        Log::Warn("OffsetCache: ignoring unreadable {} ({}).", path.string(), e.what());
+        _modules.clear();
+        _fields.clear();
+        _dirty = true;
+        return false;
+    }
+}
+
+bool OffsetCache::Save(const std::filesystem::path& path)
+{
+    if (!_dirty)
+        return true;
+
+    auto modules = nlohmann::json::object();
+    for (const auto& [module, entry] : _modules)
+    {
+        if (entry.BuildId.empty())
+            continue;
+        auto signatures = nlohmann::json::object();
+        for (const auto& [name, rva] : entry.Signatures)
+            signatures[name] = rva;
+        modules[module] = {{"build", entry.BuildId}, {"signatures", std::move(signatures)}};
+    }
+
+    auto schema = nlohmann::json::object();
+    for (const auto& [key, field] : _fields)
+        schema[key] = {field.Offset, field.Size};
+
+    const nlohmann::json json{{"version", FormatVersion}, {"modules", std::move(modules)}, {"schema", std::move(schema)}};
+
+    std::error_code ec;
+    std::filesystem::create_directories(path.parent_path(), ec);
+    // Write-then-rename so a crash mid-write never leaves a truncated cache behind.
+    auto temp = path;
+    temp += ".tmp";
+    {
+        std::ofstream file(temp, std::ios::trunc);
+        if (!file.is_open())
+            return false;
+        file << json.dump(1);
+        if (!file.good())
+            return false;
+    }
+    std::filesystem::rename(temp, path, ec);
+    if (ec)
+        return false;
+
+    _dirty = false;
+    return true;
+}
+
+std::optional<uint64_t> OffsetCache::FindSignature(std::string_view module, std::string_view name) const
+{
+    auto moduleIt = _modules.find(module);
+    if (moduleIt == _modules.end())
+        return std::nullopt;
+    auto it = moduleIt->second.Signatures.find(name);
+    if (it == moduleIt->second.Signatures.end())
+        return std::nullopt;
+    return it->second;
+}
+
+void OffsetCache::StoreSignature(std::string_view module, std::string_view name, uint64_t rva)
+{
+    if (BuildIdOf(module).empty())
+        return;
+    auto& signatures = _modules.find(module)->second.Signatures;
+    auto it = signatures.find(name);
+    if (it != signatures.end() && it->second == rva)
+        return;
+    signatures.insert_or_assign(std::string(name), rva);
+    _dirty = true;
+}
+
+void OffsetCache::ForgetSignature(std::string_view module, std::string_view name)
+{
+    auto moduleIt = _modules.find(module);
+    if (moduleIt == _modules.end())
+        return;
+    auto& signatures = moduleIt->second.Signatures;
+    if (auto it = signatures.find(name); it != signatures.end())
+    {
+        signatures.erase(it);
+        _dirty = true;
+    }
+}
+
+std::optional<OffsetCache::Field> OffsetCache::FindField(std::string_view className, std::string_view fieldName) const
+{
+    auto it = _fields.find(FieldKey(className, fieldName));
+    if (it == _fields.end())
+        return std::nullopt;
+    return it->second;
+}
+
+void OffsetCache::StoreField(std::string_view className, std::string_view fieldName, Field field)
+{
+    if (BuildIdOf(SchemaModule).empty())
+        return;
+    auto key = FieldKey(className, fieldName);
+    auto it = _fields.find(key);
+    if (it != _fields.end() && it->second.Offset == field.Offset && it->second.Size == field.Size)
+        return;
+    _fields.insert_or_assign(std::move(key), field);
+    _dirty = true;
+}
+
+void OffsetCache::ForgetField(std::string_view className, std::string_view fieldName)
+{
+    if (_fields.erase(FieldKey(className, fieldName)) != 0)
+        _dirty = true;
+}
+
+size_t OffsetCache::SignatureCount() const
+{
+    size_t count = 0;
+    for (const auto& [module, entry] : _modules)
+        count += entry.Signatures.size();
+    return count;
+}
+
+}  // namespace CS2Kit::Sdk
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Sdk/SchemaFields.hpp"
+
+#include <CS2Kit/Sdk/SchemaField.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <mathlib/vector.h>
+
+// Player-pawn schema fields read by PlayerController and PawnView. Separate from SchemaFields.hpp
+// because several carry HL2SDK types (Vector, QAngle), which the SDK-free test/bench TUs lack.
+namespace CS2Kit::Sdk::Fields
+{
+
+using Flags = SchemaField<"CBaseEntity", "m_fFlags", uint32_t>;
+using AbsVelocity = SchemaField<"CBaseEntity", "m_vecAbsVelocity", Vector>;
+using MoveTypeField = SchemaField<"CBaseEntity", "m_MoveType", uint8_t>;
+using ActualMoveType = SchemaField<"CBaseEntity", "m_nActualMoveType", uint8_t>;
+using ViewOffset = SchemaField<"CBaseModelEntity", "m_vecViewOffset", Vector>;
+using ArmorValue = SchemaField<"CCSPlayerPawn", "m_ArmorValue", int>;
+using VelocityModifier = SchemaField<"CCSPlayerPawn", "m_flVelocityModifier", float>;
+using EyeAngles = SchemaField<"CCSPlayerPawnBase", "m_angEyeAngles", QAngle>;
+using FlashDuration = SchemaField<"CCSPlayerPawnBase", "m_flFlashDuration", float>;
+using FlashMaxAlpha = SchemaField<"CCSPlayerPawnBase", "m_flFlashMaxAlpha", float>;
+
+// Read from the pawn's scene node (a CSkeletonInstance), not the pawn itself.
+using AbsOrigin = SchemaField<"CGameSceneNode", "m_vecAbsOrigin", Vector>;
+using AbsRotation = SchemaField<"CGameSceneNode", "m_angAbsRotation", QAngle>;
+using ModelState = SchemaField<"CSkeletonInstance", "m_modelState", std::byte, 0>;  // embedded CModelState
+using ModelName = SchemaField<"CModelState", "m_ModelName", const char*>;         // interned CUtlSymbolLarge
+
+}  // namespace CS2Kit::Sdk::Fields
@@ -1,7 +1,10 @@
+#include "Sdk/PawnFields.hpp"
+
 #include <CS2Kit/Core/Services.hpp>
 #include <CS2Kit/Sdk/Entity.hpp>
 #include <CS2Kit/Sdk/MoveType.hpp>
 #include <CS2Kit/Sdk/PawnOps.hpp>
+#include <CS2Kit/Sdk/PawnView.hpp>
 #include <cmath>
 #include <mathlib/vector.h>
 #include <numbers>
@@ -22,8 +25,9 @@ float Rand(float lo, float hi)
 
 Vector ClearedDestination(const PlayerController& anchor, float clearance)
 {
-    Vector origin = anchor.GetAbsOrigin();
-    float yawRad = anchor.GetEyeAngles().y * std::numbers::pi_v<float> / 180.0f;
+    PawnView pawn(anchor);
+    Vector origin = pawn.GetAbsOrigin();
+    float yawRad = pawn.GetEyeAngles().y * std::numbers::pi_v<float> / 180.0f;
     origin.x += std::cos(yawRad) * clearance;
     origin.y += std::sin(yawRad) * clearance;
     return origin;
@@ -67,8 +71,9 @@ bool HasGodmode(const PlayerController& pc)
 
 void SetGodmode(const PlayerController& pc, bool enable)
 {
-    uint32_t flags = pc.GetFlags();
-    pc.SetFlags(enable ? (flags | FL_GODMODE) : (flags & ~FL_GODMODE));
+    PawnView pawn(pc);
+    uint32_t flags = pawn.GetFlags();
+    pawn.Set<Fields::Flags>(enable ? (flags | FL_GODMODE) : (flags & ~FL_GODMODE));
 }
 
 bool ToggleGodmode(const PlayerController& pc)
@@ -0,0 +1,116 @@
+#include "Sdk/PawnFields.hpp"
+
+#include <CS2Kit/Core/Services.hpp>
+#include <CS2Kit/Sdk/Entity.hpp>
+#include <CS2Kit/Sdk/PawnView.hpp>
+#include <entity2/entityinstance.h>
+#include <mathlib/vector.h>
+
+using CS2Kit::Core::Engine;
+
+namespace CS2Kit::Sdk
+{
+
+PawnView::PawnView(int slot)
+{
+    auto* controller = Engine().Entities.GetPlayerController(slot);
+    _pawn = Engine().Entities.ResolveEntityHandle(Fields::ControllerPlayerPawn::Get(controller, Fields::InvalidHandle));
+    ResolveSceneNode();
+}
+
+PawnView::PawnView(const PlayerController& controller) : _pawn(controller.GetPawn())
+{
+    ResolveSceneNode();
+}
+
+PawnView::PawnView(CEntityInstance* pawn) : _pawn(pawn)
+{
+    ResolveSceneNode();
+}
+
+void PawnView::ResolveSceneNode()
+{
+    // Origin/rotation are not schema fields of CBaseEntity in CS2; they live on the
+    // pawn's CGameSceneNode, reached via m_CBodyComponent -> m_pSceneNode.
+    _sceneNode = Fields::SceneNode::Get(Fields::BodyComponent::Get(_pawn));
+}
+
+int PawnView::GetHealth() const
+{
+    return Get<Fields::Health>();
+}
+
+int PawnView::GetTeam() const
+{
+    return Get<Fields::TeamNum>();
+}
+
+int PawnView::GetLifeState() const
+{
+    return Get<Fields::LifeState>();
+}
+
+bool PawnView::IsAlive() const
+{
+    return _pawn != nullptr && GetLifeState() == 0;
+}
+
+int PawnView::GetArmor() const
+{
+    return Get<Fields::ArmorValue>();
+}
+
+uint32_t PawnView::GetFlags() const
+{
+    return Get<Fields::Flags>();
+}
+
+MoveType PawnView::GetMoveType() const
+{
+    return static_cast<MoveType>(Get<Fields::MoveTypeField>());
+}
+
+Vector PawnView::GetVelocity() const
+{
+    return Get<Fields::AbsVelocity>(Vector(0.0f, 0.0f, 0.0f));
+}
+
+Vector PawnView::GetAbsOrigin() const
+{
+    return Get<Fields::AbsOrigin>(Vector(0.0f, 0.0f, 0.0f));
+}
+
+QAngle PawnView::GetAbsAngles() const
+{
+    return Get<Fields::AbsRotation>(QAngle(0.0f, 0.0f, 0.0f));
+}
+
+QAngle PawnView::GetEyeAngles() const
+{
+    return Get<Fields::EyeAngles>(QAngle(0.0f, 0.0f, 0.0f));
+}
+
+Vector PawnView::GetEyePosition() const
+{
+    return GetAbsOrigin() + Get<Fields::ViewOffset>(Vector(0.0f, 0.0f, 0.0f));
+}
+
+float PawnView::GetFlashDuration() const
+{
+    return Get<Fields::FlashDuration>();
+}
+
+float PawnView::GetFlashMaxAlpha() const
+{
+    return Get<Fields::FlashMaxAlpha>();
+}
+
+std::string PawnView::GetModelName() const
+{
+    // The scene node is a CSkeletonInstance; the model path is the
+    // CUtlSymbolLarge inside its embedded CModelState (interned string pointer).
+    const char* name = Fields::ModelName::Get(Fields::ModelState::Ptr(_sceneNode));
+    return name ? std::string(name) : std::string{};
+}
+
+}  // namespace CS2Kit::Sdk
@@ -24,7 +24,7 @@ void PersistentCenterHtml::Show(int slot, int refreshMs, std::function<std::stri
 
     auto send = [slot, render = std::move(render)]() { Core::Engine().Messages.SendCenterHtml(slot, render(slot)); };
     send();
-    _timers[slot] = Core::Engine().Scheduler.Repeat(refreshMs, send);
+    _timers[slot] = Core::Engine().Scheduler.Repeat(refreshMs, std::move(send));
 }
 
 void PersistentCenterHtml::Stop(int slot)
@@ -1,4 +1,4 @@
-#include "Sdk/Schema.hpp"
+#include "Sdk/PawnFields.hpp"
 #include "Sdk/VirtualCall.hpp"
 
 #include <CS2Kit/Core/Services.hpp>
@@ -8,6 +8,7 @@
 #include <CS2Kit/Sdk/GameData.hpp>
 #include <CS2Kit/Sdk/GameInterfaces.hpp>
 #include <CS2Kit/Sdk/MemoryAccess.hpp>
+#include <CS2Kit/Sdk/PawnView.hpp>
 #include <CS2Kit/Sdk/PlayerController.hpp>
 #include <CS2Kit/Utils/Log.hpp>
 #include <algorithm>
@@ -41,39 +42,6 @@ void CallVtableByName(void* target, const char* name, Args... args)
     }
     CallVirtual<void>(index, target, args...);
 }
-
-// Origin/rotation are not schema fields of CBaseEntity in CS2; they live on the
-// pawn's CGameSceneNode, reached via m_CBodyComponent -> m_pSceneNode.
-void* ResolveSceneNode(CEntityInstance* pawn)
-{
-    if (!pawn)
-        return nullptr;
-
-    int bodyOffset = Engine().Schema().GetOffset("CBaseEntity", "m_CBodyComponent");
-    if (bodyOffset < 0)
-        return nullptr;
-    auto* body = ReadAt<uint8_t*>(pawn, bodyOffset);
-    if (!body)
-        return nullptr;
-
-    int nodeOffset = Engine().Schema().GetOffset("CBodyComponent", "m_pSceneNode");
-    if (nodeOffset < 0)
-        return nullptr;
-    return ReadAt<void*>(body, nodeOffset);
-}
-
-template <typename T>
-T GetSceneNodeField(CEntityInstance* pawn, const char* fieldName)
-{
-    void* node = ResolveSceneNode(pawn);
-    if (!node)
-        return T{0.0f, 0.0f, 0.0f};
-
-    int offset = Engine().Schema().GetOffset("CGameSceneNode", fieldName, sizeof(T));
-    if (offset < 0)
-        return T{0.0f, 0.0f, 0.0f};
-    return ReadAt<T>(node, offset);
-}
 }  // namespace
 
 PlayerController::PlayerController(int slot) : _slot(slot)
@@ -95,13 +63,7 @@ CEntityInstance* PlayerController::GetPawn() const
 {
     if (!_controller)
         return nullptr;
-
-    int offset = Engine().Schema().GetOffset("CCSPlayerController", "m_hPlayerPawn", sizeof(uint32_t));
-    if (offset < 0)
-        return nullptr;
-
-    auto hPawn = ReadAt<uint32_t>(_controller, offset);
-    return Engine().Entities.ResolveEntityHandle(hPawn);
+    return Engine().Entities.ResolveEntityHandle(Fields::ControllerPlayerPawn::Get(_controller, Fields::InvalidHandle));
 }
 
 void PlayerController::Kick(const char* reason) const
@@ -119,29 +81,24 @@ void PlayerController::Kick(const char* reason) const
     engine->DisconnectClient(CPlayerSlot(_slot), NETWORK_DISCONNECT_KICKED, reason);
 }
 
-int PlayerController::SchemaOffset(const char* className, const char* fieldName, int expectedSize) const
-{
-    return Engine().Schema().GetOffset(className, fieldName, expectedSize);
-}
-
 int PlayerController::GetHealth() const
 {
-    return GetPawnField<int>("CBaseEntity", "m_iHealth");
+    return PawnView(*this).GetHealth();
 }
 
 int PlayerController::GetTeam() const
 {
-    return GetPawnField<int>("CBaseEntity", "m_iTeamNum");
+    return PawnView(*this).GetTeam();
 }
 
 int PlayerController::GetLifeState() const
 {
-    return GetPawnField<uint8_t>("CBaseEntity", "m_lifeState");
+    return PawnView(*this).GetLifeState();
 }
 
 bool PlayerController::IsAlive() const
 {
-    return GetPawn() != nullptr && GetLifeState() == 0;
+    return PawnView(*this).IsAlive();
 }
 
 uint64_t PlayerController::GetButtons() const
@@ -151,22 +108,23 @@ uint64_t PlayerController::GetButtons() const
 
 void PlayerController::SetHealth(int health) const
 {
-    SetPawnField<int>("CBaseEntity", "m_iHealth", health);
+    Fields::Health::Set(GetPawn(), health);
+    Engine().Snapshot.Invalidate(_slot);
 }
 
 int PlayerController::GetArmor() const
 {
-    return GetPawnField<int>("CCSPlayerPawn", "m_ArmorValue");
+    return PawnView(*this).GetArmor();
 }
 
 void PlayerController::SetArmor(int armor) const
 {
-    SetPawnField<int>("CCSPlayerPawn", "m_ArmorValue", armor);
+    Fields::ArmorValue::Set(GetPawn(), armor);
 }
 
 void PlayerController::SetSpeedModifier(float multiplier) const
 {
-    SetPawnField<float>("CCSPlayerPawn", "m_flVelocityModifier", multiplier);
+    Fields::VelocityModifier::Set(GetPawn(), multiplier);
 }
 
 void PlayerController::SetModelScale(float scale) const
@@ -182,168 +140,146 @@ void PlayerController::SetModelScale(float scale) const
 
 uint32_t PlayerController::GetFlags() const
 {
-    return GetPawnField<uint32_t>("CBaseEntity", "m_fFlags");
+    return PawnView(*this).GetFlags();
 }
 
 void PlayerController::SetFlags(uint32_t flags) const
 {
-    SetPawnField<uint32_t>("CBaseEntity", "m_fFlags", flags);
+    Fields::Flags::Set(GetPawn(), flags);
 }
 
 Vector PlayerController::GetVelocity() const
 {
-    return GetPawnField<Vector>("CBaseEntity", "m_vecAbsVelocity");
+    return PawnView(*this).GetVelocity();
 }
 
 void PlayerController::SetVelocity(const Vector& velocity) const
 {
-    SetPawnField<Vector>("CBaseEntity", "m_vecAbsVelocity", velocity);
+    Fields::AbsVelocity::Set(GetPawn(), velocity);
 }
 
 uint8_t PlayerController::GetRenderMode() const
 {
-    return GetPawnField<uint8_t>("CBaseModelEntity", "m_nRenderMode");
+    return Fields::RenderMode::Get(GetPawn());
 }
 
 uint32_t PlayerController::GetRenderColor() const
 {
-    return GetPawnField<uint32_t>("CBaseModelEntity", "m_clrRender");
+    return Fields::RenderColor::Get(GetPawn());
 }
 
 void PlayerController::SetRender(uint8_t mode, uint32_t color) const
 {
-    SetPawnField<uint8_t>("CBaseModelEntity", "m_nRenderMode", mode);
-    SetPawnField<uint32_t>("CBaseModelEntity", "m_clrRender", color);
+    auto* pawn = GetPawn();
+    Fields::RenderMode::Set(pawn, mode);
+    Fields::RenderColor::Set(pawn, color);
 }
 
 Vector PlayerController::GetAbsOrigin() const
 {
-    return GetSceneNodeField<Vector>(GetPawn(), "m_vecAbsOrigin");
+    return PawnView(*this).GetAbsOrigin();
 }
 
 QAngle PlayerController::GetAbsAngles() const
 {
-    return GetSceneNodeField<QAngle>(GetPawn(), "m_angAbsRotation");
+    return PawnView(*this).GetAbsAngles();
 }
 
 QAngle PlayerController::GetEyeAngles() const
 {
-    return GetPawnField<QAngle>("CCSPlayerPawnBase", "m_angEyeAngles");
+    return PawnView(*this).GetEyeAngles();
 }
 
 Vector PlayerController::GetEyePosition() const
 {
-    return GetAbsOrigin() + GetPawnField<Vector>("CBaseModelEntity", "m_vecViewOffset");
+    return PawnView(*this).GetEyePosition();
 }
 
 float PlayerController::GetFlashDuration() const
 {
-    return GetPawnField<float>("CCSPlayerPawnBase", "m_flFlashDuration");
+    return PawnView(*this).GetFlashDuration();
 }
 
 float PlayerController::GetFlashMaxAlpha() const
 {
-    return GetPawnField<float>("CCSPlayerPawnBase", "m_flFlashMaxAlpha");
+    return PawnView(*this).GetFlashMaxAlpha();
 }
 
 void PlayerController::Slay() const
 {
     CallVtableByName(GetPawn(), "CommitSuicide", false, true);
+    Engine().Snapshot.Invalidate(_slot);
 }
 
 void PlayerController::ChangeTeam(int team) const
 {
     CallVtableByName(_controller, "ChangeTeam", team);
+    Engine().Snapshot.Invalidate(_slot);
 }
 
 void PlayerController::Respawn() const
 {
     CallVtableByName(_controller, "Respawn");
+    Engine().Snapshot.Invalidate(_slot);
 }
 
 void PlayerController::Teleport(const Vector* origin, const QAngle* angles, const Vector* velocity) const
 {
     CallVtableByName(GetPawn(), "Teleport", origin, angles, velocity);
+    Engine().Snapshot.Invalidate(_slot);
 }
 
-namespace
-{
-// Player name is stored as a 128-byte fixed buffer on CBasePlayerController.
-constexpr size_t PlayerNameBufferSize = 128;
-}  // namespace
-
 MoveType PlayerController::GetMoveType() const
 {
-    return static_cast<MoveType>(GetPawnField<uint8_t>("CBaseEntity", "m_MoveType"));
+    return PawnView(*this).GetMoveType();
 }
 
 void PlayerController::SetMoveType(MoveType type) const
 {
+    auto* pawn = GetPawn();
     auto value = static_cast<uint8_t>(type);
-    SetPawnField<uint8_t>("CBaseEntity", "m_MoveType", value);
-    SetPawnField<uint8_t>("CBaseEntity", "m_nActualMoveType", value);
+    Fields::MoveTypeField::Set(pawn, value);
+    Fields::ActualMoveType::Set(pawn, value);
 }
 
 ObserverMode_t PlayerController::GetObserverMode() const
 {
-    return static_cast<ObserverMode_t>(GetPawnField<uint8_t>("CPlayer_ObserverServices", "m_iObserverMode"));
+    return static_cast<ObserverMode_t>(Fields::ObserverMode::Get(Fields::PawnObserverServices::Get(GetPawn())));
 }
 
 void PlayerController::SetObserverMode(ObserverMode_t mode) const
 {
-    SetPawnField<uint8_t>("CPlayer_ObserverServices", "m_iObserverMode", static_cast<uint8_t>(mode));
+    Fields::ObserverMode::Set(Fields::PawnObserverServices::Get(GetPawn()), static_cast<uint8_t>(mode));
 }
 
 std::string PlayerController::GetPlayerName() const
 {
-    if (!_controller)
+    const auto* buffer = Fields::ControllerPlayerName::Ptr(_controller);
+    if (!buffer)
         return {};
 
-    int offset = Engine().Schema().GetOffset("CBasePlayerController", "m_iszPlayerName");
-    if (offset < 0)
-        return {};
-
-    auto* p = MemberPtr<const char>(_controller, offset);
+    const char* p = buffer->data();
     size_t len = 0;
-    while (len < PlayerNameBufferSize && p[len] != '\0')
+    while (len < buffer->size() && p[len] != '\0')
         ++len;
     return std::string(p, len);
 }
 
 std::string PlayerController::GetPawnModelName() const
 {
-    // The pawn's scene node is a CSkeletonInstance; the model path is the
-    // CUtlSymbolLarge inside its embedded CModelState (interned string pointer).
-    void* node = ResolveSceneNode(GetPawn());
-    if (!node)
-        return {};
-
-    auto& schema = Engine().Schema();
-    int stateOffset = schema.GetOffset("CSkeletonInstance", "m_modelState");
-    int nameOffset = schema.GetOffset("CModelState", "m_ModelName");
-    if (stateOffset < 0 || nameOffset < 0)
-        return {};
-
-    const char* name = ReadAt<const char*>(node, stateOffset + nameOffset);
-    return name ? std::string(name) : std::string{};
+    return PawnView(*this).GetModelName();
 }
 
 void PlayerController::SetPlayerName(const std::string& name) const
 {
-    if (!_controller)
-        return;
-
-    int offset = Engine().Schema().GetOffset("CBasePlayerController", "m_iszPlayerName");
-    if (offset < 0)
+    auto* buffer = Fields::ControllerPlayerName::Ptr(_controller);
+    if (!buffer)
         return;
 
-    auto* dst = MemberPtr<char>(_controller, offset);
-    std::memset(dst, 0, PlayerNameBufferSize);
-    size_t copyLen = name.size();
-    if (copyLen >= PlayerNameBufferSize)
-        copyLen = PlayerNameBufferSize - 1;
+    buffer->fill('\0');
+    size_t copyLen = std::min(name.size(), buffer->size() - 1);
     if (copyLen > 0)
-        std::memcpy(dst, name.data(), copyLen);
+        std::memcpy(buffer->data(), name.data(), copyLen);
 }
 
 void PlayerController::SetVisible(bool visible, uint8_t alpha) const
@@ -0,0 +1,56 @@
+#include "Sdk/SchemaFields.hpp"
+
+#include <CS2Kit/Core/Services.hpp>
+#include <CS2Kit/Sdk/Entity.hpp>
+#include <CS2Kit/Sdk/PlayerSnapshot.hpp>
+
+using CS2Kit::Core::Engine;
+
+namespace CS2Kit::Sdk
+{
+
+namespace
+{
+// Same field PlayerController reads as QAngle; the snapshot keeps the header SDK-free.
+using EyeAngles = SchemaField<"CCSPlayerPawnBase", "m_angEyeAngles", Vec3>;
+}  // namespace
+
+void PlayerSnapshot::Capture()
+{
+    Core::ProfileScope scope(Engine().Profiler, _probe);
+    for (int slot = 0; slot < Core::MaxPlayers; ++slot)
+        CaptureSlot(slot);
+    ++_frame;
+}
+
+void PlayerSnapshot::CaptureSlot(int slot)
+{
+    _stale &= ~(uint64_t{1} << slot);
+
+    auto& entities = Engine().Entities;
+    auto* controller = entities.GetPlayerController(slot);
+    _controller[slot] = controller;
+
+    uint32_t pawnHandle = Fields::ControllerPlayerPawn::Get(controller, Fields::InvalidHandle);
+    auto* pawn = entities.ResolveEntityHandle(pawnHandle);
+    _pawnHandle[slot] = pawnHandle;
+    _pawn[slot] = pawn;
+    _team[slot] = Fields::TeamNum::Get(pawn);
+    _health[slot] = Fields::Health::Get(pawn);
+    _alive[slot] = pawn && Fields::LifeState::Get(pawn) == 0;
+    _origin[slot] = Fields::SceneOrigin::Get(Fields::SceneNode::Get(Fields::BodyComponent::Get(pawn)));
+    _eyeAngles[slot] = EyeAngles::Get(pawn);
+
+    // Input and observation follow the possessed pawn, which is the observer pawn while dead.
+    uint32_t currentHandle = Fields::ControllerPawn::Get(controller, Fields::InvalidHandle);
+    auto* current = currentHandle == pawnHandle ? pawn : entities.ResolveEntityHandle(currentHandle);
+    _currentPawnHandle[slot] = currentHandle;
+    _currentPawn[slot] = current;
+
+    void* movement = Fields::PawnMovementServices::Get(current);
+    _movementServices[slot] = movement;
+    _observerServices[slot] = Fields::PawnObserverServices::Get(current);
+    _buttons[slot] = Fields::ButtonStates::Get(Fields::MovementButtons::Ptr(movement))[0];  // [0] held
+}
+
+}  // namespace CS2Kit::Sdk
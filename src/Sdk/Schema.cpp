@@ -2,7 +2,10 @@
 
 #include <CS2Kit/Core/Services.hpp>
 #include <CS2Kit/Sdk/GameInterfaces.hpp>
+#include <CS2Kit/Sdk/OffsetCache.hpp>
+#include <CS2Kit/Sdk/SchemaField.hpp>
 #include <CS2Kit/Utils/Log.hpp>
+#include <format>
 #include <schemasystem/schemasystem.h>
 
 using CS2Kit::Core::Engine;
@@ -24,19 +27,17 @@ bool SchemaService::Initialize()
     return true;
 }
 
-int SchemaService::GetOffset(const char* className, const char* fieldName, int expectedSize)
+void SchemaService::WarnOnSizeMismatch(const char* className, const char* fieldName, int size, int expectedSize)
 {
-    auto* schemaSystem = Engine().Interfaces.SchemaSystem;
-    if (!schemaSystem)
-        return -1;
+    if (expectedSize > 0 && size > 0 && size != expectedSize)
+        Log::Warn("Schema: {}::{} is {} bytes but the caller expects {} (schema drift?).", className, fieldName, size,
+                  expectedSize);
+}
 
-    auto classIt = _offsetCache.find(className);
-    if (classIt != _offsetCache.end())
-    {
-        auto fieldIt = classIt->second.find(fieldName);
-        if (fieldIt != classIt->second.end())
-            return fieldIt->second;
-    }
+CSchemaSystemTypeScope* SchemaService::ServerScope()
+{
+    if (_serverScope)
+        return _serverScope;
 
 #ifdef _WIN32
     const char* moduleName = "server.dll";
@@ -44,43 +45,184 @@ int SchemaService::GetOffset(const char* className, const char* fieldName, int e
     const char* moduleName = "libserver.so";
 #endif
 
-    CSchemaSystemTypeScope* pTypeScope = schemaSystem->FindTypeScopeForModule(moduleName);
-    if (!pTypeScope)
-    {
+    _serverScope = Engine().Interfaces.SchemaSystem->FindTypeScopeForModule(moduleName);
+    if (!_serverScope)
         Log::Error("Schema: Failed to find type scope for {}.", moduleName);
-        return -1;
-    }
+    return _serverScope;
+}
+
+int SchemaService::ClassSize(const char* className)
+{
+    if (auto it = _classSizes.find(std::string_view(className)); it != _classSizes.end())
+        return it->second;
+
+    CSchemaSystemTypeScope* pTypeScope = ServerScope();
+    if (!pTypeScope)
+        return 0;
+    CSchemaClassInfo* pClassInfo = pTypeScope->FindDeclaredClass(className).Get();
+    const int size = pClassInfo ? pClassInfo->m_nSize : 0;
+    _classSizes.emplace(className, size);
+    return size;
+}
+
+bool SchemaService::CachedFieldFits(const char* className, const OffsetCache::Field& field)
+{
+    const int classSize = ClassSize(className);
+    return field.Offset >= 0 && field.Size >= 0 && field.Offset + field.Size <= classSize;
+}
+
+const SchemaService::FieldTable* SchemaService::ClassFields(const char* className, bool quiet)
+{
+    if (auto it = _classes.find(std::string_view(className)); it != _classes.end())
+        return &it->second;
+
+    CSchemaSystemTypeScope* pTypeScope = ServerScope();
+    if (!pTypeScope)
+        return nullptr;
 
     SchemaMetaInfoHandle_t<CSchemaClassInfo> hClassInfo = pTypeScope->FindDeclaredClass(className);
     CSchemaClassInfo* pClassInfo = hClassInfo.Get();
     if (!pClassInfo)
     {
-        Log::Error("Schema: Class '{}' not found.", className);
-        return -1;
+        if (!quiet)
+            Log::Error("Schema: Class '{}' not found.", className);
+        return nullptr;
     }
 
+    // One pass over the class: every later field of it is a hash lookup.
+    FieldTable table;
+    table.reserve(static_cast<size_t>(pClassInfo->m_nFieldCount));
     for (int i = 0; i < pClassInfo->m_nFieldCount; ++i)
     {
         SchemaClassFieldData_t& field = pClassInfo->m_pFields[i];
-        if (strcmp(field.m_pszName, fieldName) == 0)
+        int size = 0;
+        uint8_t alignment = 0;
+        if (!field.m_pType || !field.m_pType->GetSizeAndAlignment(size, alignment))
+            size = 0;
+        table.emplace(field.m_pszName, FieldInfo{.Offset = field.m_nSingleInheritanceOffset, .Size = size});
+    }
+    return &_classes.emplace(className, std::move(table)).first->second;
+}
+
+std::optional<SchemaService::FieldInfo> SchemaService::Find(const char* className, const char* fieldName, bool quiet,
+                                                           bool* walked)
+{
+    // Persisted from an earlier load of this same server build: skip reading the class's fields.
+    // The entry is only range-checked against the class size, which costs one class lookup.
+    auto& offsets = Engine().OffsetCache;
+    std::optional<FieldInfo> info;
+    auto cached = offsets.FindField(className, fieldName);
+    if (cached && !CachedFieldFits(className, *cached))
+    {
+        Log::Warn("Schema: cached offset {} of {}::{} lies outside the class; rereading it.", cached->Offset,
+                  className, fieldName);
+        offsets.ForgetField(className, fieldName);
+        cached.reset();
+    }
+
+    if (cached)
+    {
+        info = FieldInfo{.Offset = cached->Offset, .Size = cached->Size};
+    }
+    else
+    {
+        const bool known = _classes.contains(std::string_view(className));
+        const FieldTable* table = ClassFields(className, quiet);
+        if (walked && table && !known)
+            *walked = true;
+        if (!table)
+        {
+            // A missing class is as final as a missing field, once the scope could be searched.
+            if (_serverScope)
+                _offsetCache[className][fieldName] = -1;
+            return std::nullopt;
+        }
+        auto it = table->find(std::string_view(fieldName));
+        if (it == table->end())
         {
-            if (expectedSize > 0 && field.m_pType)
+            if (!quiet)
+                Log::Warn("Schema: Field '{}' not found in '{}'.", fieldName, className);
+            _offsetCache[className][fieldName] = -1;
+            return std::nullopt;
+        }
+        info = it->second;
+        offsets.StoreField(className, fieldName, {.Offset = info->Offset, .Size = info->Size});
+    }
+
+    _offsetCache[className][fieldName] = info->Offset;
+    return info;
+}
+
+int SchemaService::GetOffset(const char* className, const char* fieldName, int expectedSize)
+{
+    if (!Engine().Interfaces.SchemaSystem)
+        return -1;
+
+    auto classIt = _offsetCache.find(std::string_view(className));
+    if (classIt != _offsetCache.end())
+    {
+        auto fieldIt = classIt->second.find(std::string_view(fieldName));
+        if (fieldIt != classIt->second.end())
+            return fieldIt->second;  // -1 for a field already found missing: reported once
+    }
+
+    auto info = Find(className, fieldName, /*quiet=*/false);
+    if (!info)
+        return -1;
+    WarnOnSizeMismatch(className, fieldName, info->Size, expectedSize);
+    return info->Offset;
+}
+
+SchemaService::PrewarmResult SchemaService::Prewarm(std::span<const SchemaFieldDecl> fields)
+{
+    PrewarmResult result;
+    if (!Engine().Interfaces.SchemaSystem)
+        return result;
+
+    // Group by class so each class is read at most once; the same field declared with two
+    // types is counted once but size-checked (and its slot filled) for each declaration.
+    std::map<std::string_view, std::map<std::string_view, std::vector<const SchemaFieldDecl*>>> byClass;
+    for (const auto& decl : fields)
+        byClass[decl.ClassName][decl.FieldName].push_back(&decl);
+
+    result.Classes = byClass.size();
+    for (const auto& [className, classFields] : byClass)
+    {
+        result.Fields += classFields.size();
+        bool walked = false;
+        for (const auto& [fieldName, decls] : classFields)
+        {
+            const auto* first = decls.front();
+            auto info = Find(first->ClassName, first->FieldName, /*quiet=*/true, &walked);
+            if (!info)
             {
-                int size = 0;
-                uint8_t alignment = 0;
-                if (field.m_pType->GetSizeAndAlignment(size, alignment) && size != expectedSize)
-                    Log::Warn("Schema: {}::{} is {} bytes but the caller expects {} (schema drift?).", className,
-                              fieldName, size, expectedSize);
+                result.Missing.push_back(std::format("{}::{}", className, fieldName));
+                // With the schema readable the answer is final: mark the slots missing, so reads
+                // fall back without another lookup (and another warning) on every call.
+                if (_serverScope)
+                    for (const auto* decl : decls)
+                        *decl->Slot = -1;
+                continue;
             }
 
-            int offset = field.m_nSingleInheritanceOffset;
-            _offsetCache[className][fieldName] = offset;
-            return offset;
+            for (const auto* decl : decls)
+            {
+                *decl->Slot = info->Offset;
+                if (decl->ExpectedSize > 0 && info->Size > 0 && info->Size != decl->ExpectedSize)
+                    result.Drifted.push_back(std::format("{}::{} ({} bytes, expects {})", className, fieldName,
+                                                         info->Size, decl->ExpectedSize));
+            }
         }
+        if (walked)
+            ++result.Walked;
     }
+    return result;
+}
 
-    Log::Warn("Schema: Field '{}' not found in '{}'.", fieldName, className);
-    return -1;
+int ResolveSchemaOffset(const char* className, const char* fieldName, int expectedSize)
+{
+    auto* services = Core::EngineOrNull();
+    return services ? services->Schema().GetOffset(className, fieldName, expectedSize) : -1;
 }
 
 }  // namespace CS2Kit::Sdk
@@ -1,8 +1,18 @@
 #pragma once
 
+#include <CS2Kit/Sdk/OffsetCache.hpp>
+#include <CS2Kit/Sdk/SchemaField.hpp>
 #include <cstdint>
+#include <functional>
 #include <map>
+#include <optional>
+#include <span>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class CSchemaSystemTypeScope;
 
 namespace CS2Kit::Sdk
 {
@@ -10,24 +20,76 @@ namespace CS2Kit::Sdk
 /**
  * Runtime schema field offset resolution via ISchemaSystem.
  * Provides access to entity field offsets at runtime by querying the
- * engine's schema system. Results are cached for O(1) repeated access.
+ * engine's schema system. Results are cached for O(1) repeated access; hot paths should
+ * use @ref SchemaField, which caches per field and skips this lookup entirely.
+ *
+ * A class's fields are read in one pass the first time any of them is needed, into a hashed
+ * table, so every later field of that class is a hash lookup rather than another linear walk
+ * of `CSchemaClassInfo::m_pFields`.
  */
 class SchemaService
 {
 public:
+    /** Outcome of @ref Prewarm, for the load report. */
+    struct PrewarmResult
+    {
+        size_t Fields = 0;     ///< Distinct declared fields.
+        size_t Classes = 0;    ///< Distinct declaring classes.
+        size_t Walked = 0;     ///< Classes whose field list had to be read (the rest came from OffsetCache).
+        std::vector<std::string> Missing;  ///< "Class::field" (field or whole class not found)
+        std::vector<std::string> Drifted;  ///< "Class::field (N bytes, expects M)"
+    };
+
     SchemaService() = default;
 
     bool Initialize();
 
     /**
-     * Field offset via the engine's schema system (cached). When `expectedSize` > 0, the
-     * first (uncached) lookup also compares the engine's field size against it and warns
-     * on mismatch - catches schema drift after a game update. Warning-only.
+     * Field offset via the engine's schema system, cached in memory and, through
+     * @ref OffsetCache, across loads of the same server build. When `expectedSize` > 0, the
+     * first lookup in this load also compares the engine's field size against it and warns on
+     * mismatch - catches schema drift after a game update. Warning-only.
      */
     int GetOffset(const char* className, const char* fieldName, int expectedSize = 0);
 
+    /**
+     * @brief Resolve every declared field up front, writing each offset into its SchemaField
+     * slot. Silent: problems are collected into the result for one consolidated report.
+     */
+    PrewarmResult Prewarm(std::span<const SchemaFieldDecl> fields);
+
 private:
-    std::map<std::string, std::map<std::string, int>> _offsetCache;
+    struct FieldInfo
+    {
+        int Offset = -1;
+        int Size = 0;  // 0 when the engine reports none
+    };
+
+    struct StringHash
+    {
+        using is_transparent = void;
+        size_t operator()(std::string_view text) const { return std::hash<std::string_view>{}(text); }
+    };
+
+    using FieldTable = std::unordered_map<std::string, FieldInfo, StringHash, std::equal_to<>>;
+
+    static void WarnOnSizeMismatch(const char* className, const char* fieldName, int size, int expectedSize);
+
+    CSchemaSystemTypeScope* ServerScope();
+    /** The class's declared size in bytes, cached per class; 0 if the class is gone. No field walk. */
+    int ClassSize(const char* className);
+    /** Whether an OffsetCache entry still fits inside its class (a stale or edited file might not). */
+    bool CachedFieldFits(const char* className, const OffsetCache::Field& field);
+    /** The class's field table, reading its fields on first use; null (logged unless @p quiet) if the class is gone. */
+    const FieldTable* ClassFields(const char* className, bool quiet = false);
+    /** OffsetCache first, then the class table. Records a hit in both caches, and a definite miss as -1 in ours. */
+    std::optional<FieldInfo> Find(const char* className, const char* fieldName, bool quiet, bool* walked = nullptr);
+
+    // Transparent comparators: a cache hit looks up by const char* without building std::string keys.
+    std::map<std::string, std::map<std::string, int, std::less<>>, std::less<>> _offsetCache;
+    std::unordered_map<std::string, FieldTable, StringHash, std::equal_to<>> _classes;
+    std::unordered_map<std::string, int, StringHash, std::equal_to<>> _classSizes;
+    CSchemaSystemTypeScope* _serverScope = nullptr;
 };
 
 }  // namespace CS2Kit::Sdk
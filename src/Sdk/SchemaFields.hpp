@@ -0,0 +1,48 @@
+#pragma once
+
+#include <CS2Kit/Sdk/SchemaField.hpp>
+#include <CS2Kit/Sdk/Vec3.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Schema fields the kit reads from more than one translation unit. Fields used by a single
+// accessor are declared next to it; the same alias in two places shares one resolved offset.
+namespace CS2Kit::Sdk::Fields
+{
+
+/** INVALID_EHANDLE_INDEX: the fallback for handle fields, so an unresolved one resolves to no entity. */
+inline constexpr uint32_t InvalidHandle = 0xFFFFFFFFu;
+
+// Player controller.
+using ControllerPawn = SchemaField<"CBasePlayerController", "m_hPawn", uint32_t>;  // possessed (observer pawn when dead)
+using ControllerPlayerPawn = SchemaField<"CCSPlayerController", "m_hPlayerPawn", uint32_t>;  // the player's own pawn
+using ControllerPlayerName = SchemaField<"CBasePlayerController", "m_iszPlayerName", std::array<char, 128>>;  // NUL-padded
+
+// Base entity state read per player.
+using Health = SchemaField<"CBaseEntity", "m_iHealth", int>;
+using TeamNum = SchemaField<"CBaseEntity", "m_iTeamNum", int>;
+using LifeState = SchemaField<"CBaseEntity", "m_lifeState", uint8_t>;  // 0 = alive
+
+// Origin/rotation live on the entity's CGameSceneNode, reached via m_CBodyComponent -> m_pSceneNode.
+using BodyComponent = SchemaField<"CBaseEntity", "m_CBodyComponent", void*>;
+using SceneNode = SchemaField<"CBodyComponent", "m_pSceneNode", void*>;
+using SceneOrigin = SchemaField<"CGameSceneNode", "m_vecAbsOrigin", Vec3>;  // as PawnFields AbsOrigin, SDK-free
+
+// Player pawn services (each a pointer to a component object).
+using PawnMovementServices = SchemaField<"CBasePlayerPawn", "m_pMovementServices", void*>;
+using PawnObserverServices = SchemaField<"CBasePlayerPawn", "m_pObserverServices", void*>;
+using PawnWeaponServices = SchemaField<"CBasePlayerPawn", "m_pWeaponServices", void*>;
+
+using ObserverMode = SchemaField<"CPlayer_ObserverServices", "m_iObserverMode", uint8_t>;
+using ObserverTarget = SchemaField<"CPlayer_ObserverServices", "m_hObserverTarget", uint32_t>;
+
+// m_nButtons is an embedded CInButtonState; m_pButtonStates is uint64[3]: held, changed, scroll.
+using MovementButtons = SchemaField<"CPlayer_MovementServices", "m_nButtons", std::byte, 0>;
+using ButtonStates = SchemaField<"CInButtonState", "m_pButtonStates", std::array<uint64_t, 3>>;
+
+// Model rendering.
+using RenderMode = SchemaField<"CBaseModelEntity", "m_nRenderMode", uint8_t>;
+using RenderColor = SchemaField<"CBaseModelEntity", "m_clrRender", uint32_t>;
+
+}  // namespace CS2Kit::Sdk::Fields
@@ -1,9 +1,21 @@
 #include "Sdk/SigScanner.hpp"
 
 #include <CS2Kit/Utils/Log.hpp>
+#include <array>
+#include <bit>
+#include <filesystem>
 #include <sstream>
+#include <string>
 #include <vector>
 
+#if defined(__x86_64__) || defined(_M_X64)
+#define CS2KIT_SIGSCAN_X64 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
 #ifdef _WIN32
 #include <psapi.h>
 #else
@@ -17,10 +29,18 @@ namespace CS2Kit::Sdk
 
 using namespace CS2Kit::Utils;
 
-struct PatternByte
+// A parsed pattern, ready for a masked compare: `(byte & mask[j]) == bytes[j]` at every offset j.
+// The vector kernels first look for the two anchor bytes, the rarest literal bytes of the pattern,
+// and only verify the positions where both line up.
+struct CompiledPattern
 {
-    uint8_t value;
-    bool wildcard;
+    std::vector<uint8_t> bytes;  // literal bytes; 0 under a wildcard
+    std::vector<uint8_t> mask;   // 0xFF for a literal byte, 0x00 for a wildcard
+    size_t anchor = 0;           // offset of the rarest literal byte
+    size_t anchor2 = 0;          // offset of the next rarest; == anchor with a single literal byte
+    bool hasLiteral = false;     // false when every byte is a wildcard
+
+    size_t size() const { return bytes.size(); }
 };
 
 // A mapped region to scan: the whole image on Windows, one PT_LOAD segment on Linux (so we never
@@ -31,9 +51,57 @@ struct ScanRange
     size_t size;
 };
 
-static std::vector<PatternByte> ParsePattern(const std::string& pattern)
+// The selected mapping of a module: where it is loaded, what build it is, and what to scan.
+struct ModuleImage
+{
+    uintptr_t base = 0;
+    std::string buildId;
+    std::vector<ScanRange> ranges;
+};
+
+static std::string ModuleFileName(const char* moduleName)
+{
+#ifdef _WIN32
+    return std::string(moduleName) + ".dll";
+#else
+    return std::string("lib") + moduleName + ".so";
+#endif
+}
+
+static std::string HexString(const uint8_t* bytes, size_t size)
 {
-    std::vector<PatternByte> bytes;
+    static constexpr char Digits[] = "0123456789abcdef";
+    std::string hex;
+    hex.reserve(size * 2);
+    for (size_t i = 0; i < size; ++i)
+    {
+        hex.push_back(Digits[bytes[i] >> 4]);
+        hex.push_back(Digits[bytes[i] & 0xF]);
+    }
+    return hex;
+}
+
+// Coarse byte frequencies of x86-64 code, higher = more common: REX prefixes, mov/lea/call/jcc
+// opcodes, stack-frame ModRM/SIB bytes and 0x00/0xFF immediates make up most of libserver's text.
+// Every unlisted value counts as rare. Only the order matters: it picks the anchors.
+static constexpr std::array<uint8_t, 256> ByteFrequency = [] {
+    constexpr uint8_t MostCommonFirst[] = {
+        0x00, 0xFF, 0x48, 0x8B, 0x89, 0x0F, 0xE8, 0x24, 0x4C, 0x41, 0x83, 0x8D, 0x85, 0xC0, 0x44, 0x45,
+        0x49, 0x74, 0x75, 0x01, 0xCC, 0x10, 0x08, 0x20, 0x18, 0xE9, 0xEB, 0xC3, 0x84, 0x39, 0x31, 0x90,
+        0x4D, 0x55, 0x53, 0x5D, 0x5B, 0x28, 0x30, 0x38, 0x40, 0xF8, 0xC7, 0x66, 0x0D, 0x05, 0x02, 0x04,
+    };
+    std::array<uint8_t, 256> frequency{};
+    for (auto& f : frequency)
+        f = 1;
+    uint8_t rank = 255;
+    for (uint8_t byte : MostCommonFirst)
+        frequency[byte] = rank--;
+    return frequency;
+}();
+
+static CompiledPattern ParsePattern(const std::string& pattern)
+{
+    CompiledPattern compiled;
     std::istringstream stream(pattern);
     std::string token;
 
@@ -41,42 +109,210 @@ static std::vector<PatternByte> ParsePattern(const std::string& pattern)
     {
         if (token == "?" || token == "??")
         {
-            bytes.push_back({0, true});
+            compiled.bytes.push_back(0);
+            compiled.mask.push_back(0x00);
         }
         else
         {
-            bytes.push_back({static_cast<uint8_t>(std::stoul(token, nullptr, 16)), false});
+            compiled.bytes.push_back(static_cast<uint8_t>(std::stoul(token, nullptr, 16)));
+            compiled.mask.push_back(0xFF);
         }
     }
-    return bytes;
+
+    // Rarest literal byte first, ties to the earlier offset; the second anchor is the rarest of the rest.
+    auto rarest = [&](size_t skip) {
+        size_t best = skip;
+        for (size_t j = 0; j < compiled.size(); ++j)
+        {
+            if (j == skip || compiled.mask[j] == 0)
+                continue;
+            if (best == skip || ByteFrequency[compiled.bytes[j]] < ByteFrequency[compiled.bytes[best]])
+                best = j;
+        }
+        return best;
+    };
+    constexpr size_t None = static_cast<size_t>(-1);
+    const size_t anchor = rarest(None);
+    if (anchor != None)
+    {
+        compiled.hasLiteral = true;
+        compiled.anchor = anchor;
+        compiled.anchor2 = rarest(anchor);  // anchor itself when it is the only literal byte
+    }
+    return compiled;
 }
 
-static void* ScanMemory(const uint8_t* base, size_t size, const std::vector<PatternByte>& pattern)
+static bool MatchesAt(const uint8_t* at, const CompiledPattern& pattern)
 {
-    if (pattern.empty() || size < pattern.size())
-        return nullptr;
+    for (size_t j = 0; j < pattern.size(); ++j)
+    {
+        if ((at[j] & pattern.mask[j]) != pattern.bytes[j])
+            return false;
+    }
+    return true;
+}
+
+// Candidate positions [from, last] of @p base, one at a time: the reference kernel, and the tail
+// the vector kernels leave over.
+static const uint8_t* ScanScalar(const uint8_t* base, size_t from, size_t last, const CompiledPattern& pattern)
+{
+    for (size_t i = from; i <= last; ++i)
+    {
+        if (MatchesAt(base + i, pattern))
+            return base + i;
+    }
+    return nullptr;
+}
+
+#ifdef CS2KIT_SIGSCAN_X64
+
+#if defined(__GNUC__) || defined(__clang__)
+#define CS2KIT_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define CS2KIT_TARGET_AVX2
+#endif
+
+// 16 candidate positions per step: compare both anchor bytes of each position at once and verify
+// only where both match. Position i reads base[i + anchor], so for i <= last every load stays
+// inside the range.
+static const uint8_t* ScanSse2(const uint8_t* base, size_t last, const CompiledPattern& pattern)
+{
+    const __m128i first = _mm_set1_epi8(static_cast<char>(pattern.bytes[pattern.anchor]));
+    const __m128i second = _mm_set1_epi8(static_cast<char>(pattern.bytes[pattern.anchor2]));
+    const uint8_t* firstAt = base + pattern.anchor;
+    const uint8_t* secondAt = base + pattern.anchor2;
 
-    size_t scanEnd = size - pattern.size();
-    for (size_t i = 0; i <= scanEnd; ++i)
+    size_t i = 0;
+    for (; i + 15 <= last; i += 16)
     {
-        bool found = true;
-        for (size_t j = 0; j < pattern.size(); ++j)
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(firstAt + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(secondAt + i));
+        auto candidates = static_cast<uint32_t>(
+            _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, second))));
+        while (candidates)
         {
-            if (!pattern[j].wildcard && base[i + j] != pattern[j].value)
-            {
-                found = false;
-                break;
-            }
+            const size_t at = i + static_cast<size_t>(std::countr_zero(candidates));
+            if (MatchesAt(base + at, pattern))
+                return base + at;
+            candidates &= candidates - 1;
         }
-        if (found)
-            return const_cast<uint8_t*>(base + i);
     }
-    return nullptr;
+    return i <= last ? ScanScalar(base, i, last, pattern) : nullptr;
+}
+
+// ScanSse2 at 32 positions per step.
+CS2KIT_TARGET_AVX2 static const uint8_t* ScanAvx2(const uint8_t* base, size_t last, const CompiledPattern& pattern)
+{
+    const __m256i first = _mm256_set1_epi8(static_cast<char>(pattern.bytes[pattern.anchor]));
+    const __m256i second = _mm256_set1_epi8(static_cast<char>(pattern.bytes[pattern.anchor2]));
+    const uint8_t* firstAt = base + pattern.anchor;
+    const uint8_t* secondAt = base + pattern.anchor2;
+
+    size_t i = 0;
+    for (; i + 31 <= last; i += 32)
+    {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(firstAt + i));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(secondAt + i));
+        auto candidates = static_cast<uint32_t>(
+            _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, second))));
+        while (candidates)
+        {
+            const size_t at = i + static_cast<size_t>(std::countr_zero(candidates));
+            if (MatchesAt(base + at, pattern))
+                return base + at;
+            candidates &= candidates - 1;
+        }
+    }
+    return i <= last ? ScanScalar(base, i, last, pattern) : nullptr;
+}
+
+static bool CpuHasAvx2()
+{
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7)
+        return false;
+    // AVX2 also needs the OS to save the YMM state (OSXSAVE + XCR0 bits 1-2).
+    __cpuid(info, 1);
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool avx = (info[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6)
+        return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif
+
+bool ScanKernelSupported(ScanKernel kernel)
+{
+    switch (kernel)
+    {
+    case ScanKernel::Auto:
+    case ScanKernel::Scalar:
+        return true;
+#ifdef CS2KIT_SIGSCAN_X64
+    case ScanKernel::Sse2:
+        return true;  // part of the x86-64 baseline
+    case ScanKernel::Avx2:
+    {
+        static const bool avx2 = CpuHasAvx2();
+        return avx2;
+    }
+#else
+    case ScanKernel::Sse2:
+    case ScanKernel::Avx2:
+        return false;
+#endif
+    }
+    return false;
+}
+
+// The kernel that actually runs: Auto is the widest supported, and an unsupported request falls
+// back to the next narrower one.
+static ScanKernel Resolve(ScanKernel kernel)
+{
+    if (kernel == ScanKernel::Auto)
+        kernel = ScanKernel::Avx2;
+    if (kernel == ScanKernel::Avx2 && !ScanKernelSupported(ScanKernel::Avx2))
+        kernel = ScanKernel::Sse2;
+    if (kernel == ScanKernel::Sse2 && !ScanKernelSupported(ScanKernel::Sse2))
+        kernel = ScanKernel::Scalar;
+    return kernel;
+}
+
+static void* ScanMemory(const uint8_t* base, size_t size, const CompiledPattern& pattern, ScanKernel kernel)
+{
+    if (pattern.size() == 0 || size < pattern.size())
+        return nullptr;
+
+    const size_t last = size - pattern.size();
+    const uint8_t* hit = nullptr;
+    // An all-wildcard pattern matches at offset 0; there is no byte to search for.
+    switch (pattern.hasLiteral ? kernel : ScanKernel::Scalar)
+    {
+#ifdef CS2KIT_SIGSCAN_X64
+    case ScanKernel::Avx2:
+        hit = ScanAvx2(base, last, pattern);
+        break;
+    case ScanKernel::Sse2:
+        hit = ScanSse2(base, last, pattern);
+        break;
+#endif
+    default:
+        hit = ScanScalar(base, 0, last, pattern);
+        break;
+    }
+    return const_cast<uint8_t*>(hit);
 }
 
 #ifdef _WIN32
 
-static bool GetScanRanges(const char* moduleName, std::vector<ScanRange>& ranges)
+static bool FindModule(const char* moduleName, ModuleImage& image)
 {
     HANDLE hProcess = GetCurrentProcess();
     HMODULE hModules[1024];
@@ -121,7 +357,15 @@ static bool GetScanRanges(const char* moduleName, std::vector<ScanRange>& ranges
     if (!GetModuleInformation(hProcess, bestModule, &modInfo, sizeof(modInfo)))
         return false;
 
-    ranges.push_back({static_cast<const uint8_t*>(modInfo.lpBaseOfDll), modInfo.SizeOfImage});
+    // PE TimeDateStamp + SizeOfImage: the key symbol servers use to identify a build.
+    const auto* bytes = static_cast<const uint8_t*>(modInfo.lpBaseOfDll);
+    const auto* dos = reinterpret_cast<const IMAGE_DOS_HEADER*>(bytes);
+    const auto* nt = reinterpret_cast<const IMAGE_NT_HEADERS*>(bytes + dos->e_lfanew);
+    const uint32_t key[2] = {nt->FileHeader.TimeDateStamp, nt->OptionalHeader.SizeOfImage};
+
+    image.base = reinterpret_cast<uintptr_t>(modInfo.lpBaseOfDll);
+    image.buildId = HexString(reinterpret_cast<const uint8_t*>(key), sizeof(key));
+    image.ranges.push_back({bytes, modInfo.SizeOfImage});
     return true;
 }
 
@@ -135,11 +379,50 @@ static const char* BaseName(const char* path)
 
 struct ModuleScan
 {
-    const char* name;               // basename to match, e.g. "libserver.so"
-    size_t bestSpan;                // largest module span seen so far (selects the real lib)
-    std::vector<ScanRange> ranges;  // PT_LOAD segments of the selected module
+    const char* name;   // basename to match, e.g. "libserver.so"
+    size_t bestSpan;    // largest module span seen so far (selects the real lib)
+    ModuleImage image;  // the selected module: PT_LOAD segments, base, build id
 };
 
+// NT_GNU_BUILD_ID from the module's PT_NOTE segments (hex), or empty when it was linked without one.
+static std::string ReadBuildId(const dl_phdr_info* info)
+{
+    for (int i = 0; i < info->dlpi_phnum; ++i)
+    {
+        const auto& phdr = info->dlpi_phdr[i];
+        if (phdr.p_type != PT_NOTE)
+            continue;
+
+        const auto* note = reinterpret_cast<const uint8_t*>(info->dlpi_addr + phdr.p_vaddr);
+        const auto* end = note + phdr.p_memsz;
+        while (note + sizeof(ElfW(Nhdr)) <= end)
+        {
+            const auto* header = reinterpret_cast<const ElfW(Nhdr)*>(note);
+            const auto* name = note + sizeof(ElfW(Nhdr));
+            const auto* desc = name + ((header->n_namesz + 3) & ~3u);
+            if (desc + header->n_descsz > end)
+                break;
+            if (header->n_type == NT_GNU_BUILD_ID && header->n_namesz == 4 && memcmp(name, "GNU", 4) == 0)
+                return HexString(desc, header->n_descsz);
+            note = desc + ((header->n_descsz + 3) & ~3u);
+        }
+    }
+    return {};
+}
+
+// Without a build id, the file's size and mtime stand in: a game update rewrites the library.
+static std::string FileStamp(const char* path)
+{
+    std::error_code ec;
+    const auto size = std::filesystem::file_size(path, ec);
+    if (ec)
+        return {};
+    const auto mtime = std::filesystem::last_write_time(path, ec);
+    if (ec)
+        return {};
+    return "file-" + std::to_string(size) + "-" + std::to_string(mtime.time_since_epoch().count());
+}
+
 // Multiple objects can share the basename "libserver.so" (a small loader stub plus the real game
 // library); a substring + first-match scan picked the stub. Match the exact basename and keep the
 // largest-span mapping, recording its PT_LOAD segments.
@@ -165,52 +448,41 @@ static int DlIterateCallback(struct dl_phdr_info* info, size_t /*size*/, void* d
     if (span > mod->bestSpan)
     {
         mod->bestSpan = span;
-        mod->ranges = std::move(segments);
+        mod->image.base = info->dlpi_addr;
+        mod->image.ranges = std::move(segments);
+        mod->image.buildId = ReadBuildId(info);
+        if (mod->image.buildId.empty())
+            mod->image.buildId = FileStamp(info->dlpi_name);
     }
     return 0;  // keep iterating; the largest match wins
 }
 
-static bool GetScanRanges(const char* moduleName, std::vector<ScanRange>& ranges)
+static bool FindModule(const char* moduleName, ModuleImage& image)
 {
     ModuleScan mod{moduleName, 0, {}};
     dl_iterate_phdr(DlIterateCallback, &mod);
-    if (mod.ranges.empty())
+    if (mod.image.ranges.empty())
         return false;
-    ranges = std::move(mod.ranges);
+    image = std::move(mod.image);
     return true;
 }
 
 #endif
 
-ScanResult FindPatternEx(const char* moduleName, const std::string& pattern)
+// First match across @p ranges, stopping at the second one (Unique = false).
+static ScanResult ScanRanges(const std::vector<ScanRange>& ranges, const CompiledPattern& pattern,
+                             ScanKernel kernel = ScanKernel::Auto)
 {
-    std::string fullName;
-#ifdef _WIN32
-    fullName = std::string(moduleName) + ".dll";
-#else
-    fullName = std::string("lib") + moduleName + ".so";
-#endif
-
-    std::vector<ScanRange> ranges;
-    if (!GetScanRanges(fullName.c_str(), ranges))
-    {
-        Log::Error("SigScanner: Module '{}' not found.", fullName);
-        return {};
-    }
-
-    auto patternBytes = ParsePattern(pattern);
+    kernel = Resolve(kernel);
     void* first = nullptr;
     for (const auto& range : ranges)
     {
         const uint8_t* base = range.base;
         size_t size = range.size;
-        while (void* hit = ScanMemory(base, size, patternBytes))
+        while (void* hit = ScanMemory(base, size, pattern, kernel))
         {
             if (first)
-            {
-                Log::Warn("SigScanner: Pattern ambiguous in '{}' (2+ matches); using the first.", fullName);
                 return {first, false};
-            }
             first = hit;
             // Resume one byte past the hit to detect a second match.
             const auto* next = static_cast<const uint8_t*>(hit) + 1;
@@ -218,10 +490,279 @@ ScanResult FindPatternEx(const char* moduleName, const std::string& pattern)
             base = next;
         }
     }
+    return {first, true};
+}
+
+// A byte set as the vector filter reads it: row [low nibble] has bit (high nibble & 7) set for each
+// member, in one table for high nibbles 0-7 and another for 8-15.
+struct ByteSet
+{
+    std::array<uint8_t, 256> members{};
+    std::array<uint8_t, 16> rowsLow{};
+    std::array<uint8_t, 16> rowsHigh{};
+
+    void Add(uint8_t byte)
+    {
+        members[byte] = 1;
+        auto& rows = (byte >> 4) < 8 ? rowsLow : rowsHigh;
+        rows[byte & 0x0F] |= static_cast<uint8_t>(1u << ((byte >> 4) & 7));
+    }
+};
+
+// Many patterns over the same ranges in one walk. Each pattern is filed under its rarest pair of
+// adjacent literal bytes; the walk visits only offsets where a filed first byte is followed by a
+// filed second byte, and each pattern filed under that first byte gets the full masked compare at
+// the start the offset implies.
+class MultiPattern
+{
+public:
+    explicit MultiPattern(const std::vector<std::string>& patterns)
+    {
+        _patterns.reserve(patterns.size());
+        for (const auto& text : patterns)
+            _patterns.push_back(ParsePattern(text));
+
+        for (uint32_t i = 0; i < _patterns.size(); ++i)
+        {
+            const auto& pattern = _patterns[i];
+            const size_t pair = RarestLiteralPair(pattern);
+            if (pair == NoPair)
+            {
+                _unfiled.push_back(i);  // too few literal bytes to file; scanned on its own
+                continue;
+            }
+            const uint8_t first = pattern.bytes[pair];
+            const uint8_t second = pattern.bytes[pair + 1];
+            _buckets[first].push_back({i, static_cast<uint32_t>(pair), second});
+            _first.Add(first);
+            _second.Add(second);
+        }
+    }
+
+    std::vector<ScanResult> Scan(const std::vector<ScanRange>& ranges, ScanKernel kernel) const
+    {
+        Walk walk{std::vector<ScanResult>(_patterns.size()), std::vector<uint8_t>(_patterns.size()),
+                  _patterns.size() - _unfiled.size()};
+        for (uint32_t i : _unfiled)
+            walk.results[i] = ScanRanges(ranges, _patterns[i], kernel);
+
+        kernel = Resolve(kernel);
+        for (const auto& range : ranges)
+        {
+            if (walk.remaining == 0)
+                break;
+#ifdef CS2KIT_SIGSCAN_X64
+            if (kernel == ScanKernel::Avx2)
+            {
+                WalkAvx2(range, walk);
+                continue;
+            }
+#endif
+            WalkScalar(range, 0, walk);
+        }
+        return std::move(walk.results);
+    }
+
+private:
+    static constexpr size_t NoPair = static_cast<size_t>(-1);
+
+    struct Filed
+    {
+        uint32_t pattern;  // index into _patterns
+        uint32_t anchor;   // offset of the pair's first byte
+        uint8_t second;    // the pair's second byte
+    };
+
+    struct Walk
+    {
+        std::vector<ScanResult> results;
+        std::vector<uint8_t> hits;  // 0, 1, or 2 = first and second match found, pattern done
+        size_t remaining;           // filed patterns with fewer than two matches
+    };
+
+    // Offset of the adjacent literal pair with the lowest combined ByteFrequency, or NoPair.
+    static size_t RarestLiteralPair(const CompiledPattern& pattern)
+    {
+        size_t best = NoPair;
+        int bestScore = 0;
+        for (size_t j = 0; j + 1 < pattern.size(); ++j)
+        {
+            if (pattern.mask[j] == 0 || pattern.mask[j + 1] == 0)
+                continue;
+            const int score = ByteFrequency[pattern.bytes[j]] + ByteFrequency[pattern.bytes[j + 1]];
+            if (best == NoPair || score < bestScore)
+            {
+                best = j;
+                bestScore = score;
+            }
+        }
+        return best;
+    }
+
+    // Try every pattern filed under the pair at @p offset (offset + 1 < range.size). False once
+    // every filed pattern is done.
+    bool Visit(const ScanRange& range, size_t offset, Walk& walk) const
+    {
+        for (const auto& filed : _buckets[range.base[offset]])
+        {
+            if (walk.hits[filed.pattern] == 2 || offset < filed.anchor || range.base[offset + 1] != filed.second)
+                continue;
+            const size_t start = offset - filed.anchor;
+            const auto& pattern = _patterns[filed.pattern];
+            if (range.size - start < pattern.size() || !MatchesAt(range.base + start, pattern))
+                continue;
+
+            // Offsets are visited in order, so a pattern's matches arrive in address order too.
+            auto& result = walk.results[filed.pattern];
+            if (walk.hits[filed.pattern]++ == 0)
+            {
+                result.Address = const_cast<uint8_t*>(range.base + start);
+                continue;
+            }
+            result.Unique = false;
+            if (--walk.remaining == 0)
+                return false;
+        }
+        return true;
+    }
+
+    void WalkScalar(const ScanRange& range, size_t from, Walk& walk) const
+    {
+        for (size_t offset = from; offset + 1 < range.size; ++offset)
+        {
+            if (_first.members[range.base[offset]] && _second.members[range.base[offset + 1]] &&
+                !Visit(range, offset, walk))
+                return;
+        }
+    }
+
+#ifdef CS2KIT_SIGSCAN_X64
+    // 0xFF for each of @p bytes in the set: pshufb looks up the row for each byte's low nibble
+    // (an index with bit 7 set reads 0, which picks the table for its high-nibble half) and the
+    // bit for its high nibble, and a byte is a member when that bit is on in its row.
+    struct ByteSetAvx2
+    {
+        __m256i rowsLow;
+        __m256i rowsHigh;
+    };
+
+    CS2KIT_TARGET_AVX2 static ByteSetAvx2 Load(const ByteSet& set)
+    {
+        return {_mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(set.rowsLow.data()))),
+                _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(set.rowsHigh.data())))};
+    }
+
+    CS2KIT_TARGET_AVX2 static __m256i Members(const ByteSetAvx2& set, __m256i bytes)
+    {
+        const __m256i bitOf = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4,
+                                               8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+        const __m256i index = _mm256_and_si256(bytes, _mm256_set1_epi8(static_cast<char>(0x8F)));
+        const __m256i row =
+            _mm256_or_si256(_mm256_shuffle_epi8(set.rowsLow, index),
+                            _mm256_shuffle_epi8(set.rowsHigh, _mm256_xor_si256(index, _mm256_set1_epi8(-128))));
+        const __m256i bit =
+            _mm256_shuffle_epi8(bitOf, _mm256_and_si256(_mm256_srli_epi16(bytes, 4), _mm256_set1_epi8(0x0F)));
+        return _mm256_cmpeq_epi8(_mm256_and_si256(row, bit), bit);
+    }
+
+    // 32 offsets per step: first-byte membership at each offset, second-byte membership one past it.
+    CS2KIT_TARGET_AVX2 void WalkAvx2(const ScanRange& range, Walk& walk) const
+    {
+        const ByteSetAvx2 first = Load(_first);
+        const ByteSetAvx2 second = Load(_second);
+
+        size_t offset = 0;
+        for (; offset + 33 <= range.size; offset += 32)
+        {
+            const auto* at = range.base + offset;
+            const __m256i pairs =
+                _mm256_and_si256(Members(first, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(at))),
+                                 Members(second, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(at + 1))));
+            auto candidates = static_cast<uint32_t>(_mm256_movemask_epi8(pairs));
+            while (candidates)
+            {
+                if (!Visit(range, offset + static_cast<size_t>(std::countr_zero(candidates)), walk))
+                    return;
+                candidates &= candidates - 1;
+            }
+        }
+        WalkScalar(range, offset, walk);
+    }
+#endif
+
+    std::vector<CompiledPattern> _patterns;
+    std::vector<uint32_t> _unfiled;  // patterns without an adjacent literal pair
+    std::array<std::vector<Filed>, 256> _buckets;
+    ByteSet _first;   // first bytes of the filed pairs
+    ByteSet _second;  // second bytes of the filed pairs
+};
+
+ScanResult FindPatternEx(const char* moduleName, const std::string& pattern)
+{
+    const std::string fullName = ModuleFileName(moduleName);
+    ModuleImage image;
+    if (!FindModule(fullName.c_str(), image))
+    {
+        Log::Error("SigScanner: Module '{}' not found.", fullName);
+        return {};
+    }
 
-    if (!first)
+    auto result = ScanRanges(image.ranges, ParsePattern(pattern));
+    if (!result.Unique)
+        Log::Warn("SigScanner: Pattern ambiguous in '{}' (2+ matches); using the first.", fullName);
+    else if (!result.Address)
         Log::Warn("SigScanner: Pattern not found in '{}'.", fullName);
-    return {first, true};
+    return result;
+}
+
+ScanResult FindPatternInImage(const uint8_t* base, size_t size, const std::string& pattern, ScanKernel kernel)
+{
+    return ScanRanges({{base, size}}, ParsePattern(pattern), kernel);
+}
+
+std::vector<ScanResult> FindPatternsEx(const char* moduleName, const std::vector<std::string>& patterns)
+{
+    const std::string fullName = ModuleFileName(moduleName);
+    ModuleImage image;
+    if (!FindModule(fullName.c_str(), image))
+    {
+        Log::Error("SigScanner: Module '{}' not found.", fullName);
+        return std::vector<ScanResult>(patterns.size());
+    }
+    return MultiPattern(patterns).Scan(image.ranges, ScanKernel::Auto);
+}
+
+std::vector<ScanResult> FindPatternsInImage(const uint8_t* base, size_t size, const std::vector<std::string>& patterns,
+                                            ScanKernel kernel)
+{
+    return MultiPattern(patterns).Scan({{base, size}}, kernel);
+}
+
+ModuleIdentity IdentifyModule(const char* moduleName)
+{
+    ModuleImage image;
+    if (!FindModule(ModuleFileName(moduleName).c_str(), image))
+        return {};
+    return {image.base, std::move(image.buildId)};
+}
+
+bool PatternMatchesAt(const char* moduleName, const void* address, const std::string& pattern)
+{
+    ModuleImage image;
+    if (!address || !FindModule(ModuleFileName(moduleName).c_str(), image))
+        return false;
+
+    const auto compiled = ParsePattern(pattern);
+    const auto* at = static_cast<const uint8_t*>(address);
+    for (const auto& range : image.ranges)
+    {
+        // The whole pattern must lie inside one mapped range before a single byte is read.
+        if (at < range.base || static_cast<size_t>(at - range.base) > range.size ||
+            range.size - static_cast<size_t>(at - range.base) < compiled.size())
+            continue;
+        return compiled.size() != 0 && MatchesAt(at, compiled);
+    }
+    return false;
 }
 
 void* FindPattern(const char* moduleName, const std::string& pattern)
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -23,6 +25,62 @@ struct ScanResult
  */
 ScanResult FindPatternEx(const char* moduleName, const std::string& pattern);
 
+/**
+ * How a scan finds candidate positions. The vector kernels compare the pattern's two rarest
+ * literal bytes 16 (SSE2) or 32 (AVX2) positions at a time and verify only where both match;
+ * Scalar tries every position. Auto, what FindPatternEx uses, picks the widest kernel the CPU
+ * supports, and an unsupported kernel falls back to the next narrower one.
+ */
+enum class ScanKernel : uint8_t
+{
+    Auto,
+    Scalar,
+    Sse2,
+    Avx2
+};
+
+/** True when @p kernel runs as itself on this CPU rather than falling back. */
+bool ScanKernelSupported(ScanKernel kernel);
+
+/**
+ * FindPatternEx over an explicit byte range instead of a loaded module (benchmarks feed it a
+ * synthetic image; tests pin @p kernel to compare kernels). Silent: reporting is left to the caller.
+ */
+ScanResult FindPatternInImage(const uint8_t* base, size_t size, const std::string& pattern,
+                              ScanKernel kernel = ScanKernel::Auto);
+
+/**
+ * FindPatternEx for many patterns in the same module, walking each mapped range once for all of
+ * them instead of once per pattern. Every pattern is filed under its rarest pair of adjacent
+ * literal bytes; only offsets holding a filed pair (found 32 at a time with AVX2) are checked
+ * against the patterns filed there. A pattern without such a pair is scanned on its own. Results are in @p patterns order, each the first match with Unique as
+ * FindPatternEx reports it. Logs only a missing module; reporting per pattern is the caller's.
+ */
+std::vector<ScanResult> FindPatternsEx(const char* moduleName, const std::vector<std::string>& patterns);
+
+/** FindPatternsEx over an explicit byte range. The walk has AVX2 and scalar kernels; Sse2 runs scalar. */
+std::vector<ScanResult> FindPatternsInImage(const uint8_t* base, size_t size, const std::vector<std::string>& patterns,
+                                            ScanKernel kernel = ScanKernel::Auto);
+
+struct ModuleIdentity
+{
+    uintptr_t Base = 0;   // load address; signature RVAs are relative to it
+    std::string BuildId;  // empty when the module is not loaded
+};
+
+/**
+ * Load address and build identity of a loaded module: the ELF NT_GNU_BUILD_ID on Linux (file
+ * size + mtime if the library has none), PE TimeDateStamp + SizeOfImage on Windows. Two loads
+ * of the same build report the same id; a game update changes it.
+ */
+ModuleIdentity IdentifyModule(const char* moduleName);
+
+/**
+ * True when @p pattern matches the bytes at @p address, which must lie inside one of the
+ * module's mapped ranges - the cheap check that a cached signature address is still valid.
+ */
+bool PatternMatchesAt(const char* moduleName, const void* address, const std::string& pattern);
+
 /** First-match convenience wrapper over FindPatternEx. */
 void* FindPattern(const char* moduleName, const std::string& pattern);
 
@@ -0,0 +1,278 @@
+#include <CS2Kit/Sdk/SpatialIndex.hpp>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace CS2Kit::Sdk
+{
+
+namespace
+{
+
+// Cell coordinates are clamped well inside int32 so far-off or infinite query bounds stay defined.
+constexpr float MaxCellCoord = 1 << 30;
+
+// out[i] = |p[i] - c|^2. Kept free of branches and aliasing so the compiler vectorizes it.
+void SquaredDistances(const float* __restrict x, const float* __restrict y, const float* __restrict z, size_t count,
+                      const Vec3& c, float* __restrict out)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        const float dx = x[i] - c.x;
+        const float dy = y[i] - c.y;
+        const float dz = z[i] - c.z;
+        out[i] = dx * dx + dy * dy + dz * dz;
+    }
+}
+
+// out[i] = squared distance if p[i] lies inside [lo, hi], else +inf. The inside test reads the sign
+// bits of p - lo and hi - p instead of comparing floats, so the loop has no trapping compares and
+// vectorizes like the one above.
+void BoxDistances(const float* __restrict x, const float* __restrict y, const float* __restrict z, size_t count,
+                  const Vec3& lo, const Vec3& hi, const Vec3& c, float* __restrict out)
+{
+    constexpr uint32_t Outside = std::bit_cast<uint32_t>(std::numeric_limits<float>::infinity());
+    auto bits = [](float value) { return std::bit_cast<uint32_t>(value); };
+    for (size_t i = 0; i < count; ++i)
+    {
+        const uint32_t signs = bits(x[i] - lo.x) | bits(hi.x - x[i]) | bits(y[i] - lo.y) | bits(hi.y - y[i]) |
+                               bits(z[i] - lo.z) | bits(hi.z - z[i]);
+        const uint32_t outside = 0u - (signs >> 31);  // all ones when any difference is negative
+        const float dx = x[i] - c.x;
+        const float dy = y[i] - c.y;
+        const float dz = z[i] - c.z;
+        out[i] = std::bit_cast<float>((bits(dx * dx + dy * dy + dz * dz) & ~outside) | (Outside & outside));
+    }
+}
+
+void EraseValue(std::vector<uint32_t>& cell, uint32_t value)
+{
+    auto it = std::find(cell.begin(), cell.end(), value);
+    if (it == cell.end())
+        return;
+    *it = cell.back();
+    cell.pop_back();
+}
+
+}  // namespace
+
+SpatialIndex::SpatialIndex(float cellSize)
+    : _cellSize(cellSize > 1.0f ? cellSize : 1.0f), _inverseCellSize(1.0f / _cellSize)
+{
+}
+
+SpatialIndex::CellCoord SpatialIndex::CellOf(float x, float y) const
+{
+    auto clampCoord = [](float value) { return static_cast<int32_t>(std::clamp(value, -MaxCellCoord, MaxCellCoord)); };
+    return {clampCoord(std::floor(x * _inverseCellSize)), clampCoord(std::floor(y * _inverseCellSize))};
+}
+
+void SpatialIndex::Upsert(int id, const Vec3& position)
+{
+    if (id < 0)
+        return;
+
+    const int64_t key = CellKey(CellOf(position.x, position.y));
+    auto slot = static_cast<size_t>(id);
+    if (slot >= _denseOf.size())
+        _denseOf.resize(slot + 1, -1);
+
+    uint32_t dense;
+    if (_denseOf[slot] >= 0)
+    {
+        dense = static_cast<uint32_t>(_denseOf[slot]);
+        if (_cellKey[dense] != key)
+        {
+            // Drop the old cell once empty, as Remove does: Gather compares its span against _cells.size().
+            auto old = _cells.find(_cellKey[dense]);
+            EraseValue(old->second, dense);
+            if (old->second.empty())
+                _cells.erase(old);
+            _cells[key].push_back(dense);
+            _cellKey[dense] = key;
+        }
+        _x[dense] = position.x;
+        _y[dense] = position.y;
+        _z[dense] = position.z;
+    }
+    else
+    {
+        dense = static_cast<uint32_t>(_ids.size());
+        _denseOf[slot] = static_cast<int>(dense);
+        _ids.push_back(id);
+        _x.push_back(position.x);
+        _y.push_back(position.y);
+        _z.push_back(position.z);
+        _cellKey.push_back(key);
+        _cells[key].push_back(dense);
+    }
+
+    if (_ids.size() == 1)
+    {
+        _boundsMin = position;
+        _boundsMax = position;
+    }
+    else
+    {
+        _boundsMin = {std::min(_boundsMin.x, position.x), std::min(_boundsMin.y, position.y),
+                      std::min(_boundsMin.z, position.z)};
+        _boundsMax = {std::max(_boundsMax.x, position.x), std::max(_boundsMax.y, position.y),
+                      std::max(_boundsMax.z, position.z)};
+    }
+}
+
+void SpatialIndex::Remove(int id)
+{
+    if (!Contains(id))
+        return;
+
+    const auto dense = static_cast<uint32_t>(_denseOf[static_cast<size_t>(id)]);
+    auto cell = _cells.find(_cellKey[dense]);
+    EraseValue(cell->second, dense);
+    if (cell->second.empty())
+        _cells.erase(cell);
+
+    // Swap the last point into the hole and repoint its cell entry.
+    const auto last = static_cast<uint32_t>(_ids.size() - 1);
+    if (dense != last)
+    {
+        auto& lastCell = _cells[_cellKey[last]];
+        *std::find(lastCell.begin(), lastCell.end(), last) = dense;
+        _ids[dense] = _ids[last];
+        _x[dense] = _x[last];
+        _y[dense] = _y[last];
+        _z[dense] = _z[last];
+        _cellKey[dense] = _cellKey[last];
+        _denseOf[static_cast<size_t>(_ids[dense])] = static_cast<int>(dense);
+    }
+    _ids.pop_back();
+    _x.pop_back();
+    _y.pop_back();
+    _z.pop_back();
+    _cellKey.pop_back();
+    _denseOf[static_cast<size_t>(id)] = -1;
+}
+
+void SpatialIndex::Clear()
+{
+    _ids.clear();
+    _x.clear();
+    _y.clear();
+    _z.clear();
+    _cellKey.clear();
+    _denseOf.clear();
+    _cells.clear();
+    _boundsMin = {};
+    _boundsMax = {};
+}
+
+bool SpatialIndex::Contains(int id) const
+{
+    return id >= 0 && static_cast<size_t>(id) < _denseOf.size() && _denseOf[static_cast<size_t>(id)] >= 0;
+}
+
+Vec3 SpatialIndex::Position(int id) const
+{
+    if (!Contains(id))
+        return {};
+    const auto dense = static_cast<size_t>(_denseOf[static_cast<size_t>(id)]);
+    return {_x[dense], _y[dense], _z[dense]};
+}
+
+float SpatialIndex::Reach(const Vec3& center) const
+{
+    const float dx = std::max(std::abs(center.x - _boundsMin.x), std::abs(center.x - _boundsMax.x));
+    const float dy = std::max(std::abs(center.y - _boundsMin.y), std::abs(center.y - _boundsMax.y));
+    const float dz = std::max(std::abs(center.z - _boundsMin.z), std::abs(center.z - _boundsMax.z));
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+bool SpatialIndex::Gather(const Vec3& min, const Vec3& max) const
+{
+    // Clip to the occupied bounds first, then visit cells only if there are fewer of them than
+    // occupied cells; otherwise a straight scan of every point is cheaper.
+    const CellCoord lo = CellOf(std::max(min.x, _boundsMin.x), std::max(min.y, _boundsMin.y));
+    const CellCoord hi = CellOf(std::min(max.x, _boundsMax.x), std::min(max.y, _boundsMax.y));
+    _candidates.clear();
+    if (hi.X < lo.X || hi.Y < lo.Y)
+        return true;
+
+    const int64_t span = (static_cast<int64_t>(hi.X) - lo.X + 1) * (static_cast<int64_t>(hi.Y) - lo.Y + 1);
+    if (span >= static_cast<int64_t>(_cells.size()))
+        return false;
+
+    for (int32_t cx = lo.X; cx <= hi.X; ++cx)
+    {
+        for (int32_t cy = lo.Y; cy <= hi.Y; ++cy)
+        {
+            auto it = _cells.find(CellKey({cx, cy}));
+            if (it != _cells.end())
+                _candidates.insert(_candidates.end(), it->second.begin(), it->second.end());
+        }
+    }
+
+    const size_t count = _candidates.size();
+    _cx.resize(count);
+    _cy.resize(count);
+    _cz.resize(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const uint32_t dense = _candidates[i];
+        _cx[i] = _x[dense];
+        _cy[i] = _y[dense];
+        _cz[i] = _z[dense];
+    }
+    return true;
+}
+
+void SpatialIndex::Emit(float limitSq, bool gathered, std::vector<SpatialHit>& out) const
+{
+    const size_t count = gathered ? _candidates.size() : _ids.size();
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (_distSq[i] <= limitSq)
+            out.push_back({_ids[gathered ? _candidates[i] : i], _distSq[i]});
+    }
+}
+
+void SpatialIndex::QueryRadius(const Vec3& center, float radius, std::vector<SpatialHit>& out) const
+{
+    if (_ids.empty() || !(radius >= 0.0f))
+        return;
+
+    const bool gathered = Gather({center.x - radius, center.y - radius, 0.0f}, {center.x + radius, center.y + radius, 0.0f});
+    const size_t count = gathered ? _candidates.size() : _ids.size();
+    _distSq.resize(count);
+    if (gathered)
+        SquaredDistances(_cx.data(), _cy.data(), _cz.data(), count, center, _distSq.data());
+    else
+        SquaredDistances(_x.data(), _y.data(), _z.data(), count, center, _distSq.data());
+    Emit(radius * radius, gathered, out);
+}
+
+void SpatialIndex::QueryBox(const Vec3& min, const Vec3& max, std::vector<SpatialHit>& out) const
+{
+    if (_ids.empty())
+        return;
+
+    const Vec3 center{(min.x + max.x) * 0.5f, (min.y + max.y) * 0.5f, (min.z + max.z) * 0.5f};
+    const bool gathered = Gather(min, max);
+    const size_t count = gathered ? _candidates.size() : _ids.size();
+    _distSq.resize(count);
+    if (gathered)
+        BoxDistances(_cx.data(), _cy.data(), _cz.data(), count, min, max, center, _distSq.data());
+    else
+        BoxDistances(_x.data(), _y.data(), _z.data(), count, min, max, center, _distSq.data());
+    Emit(std::numeric_limits<float>::max(), gathered, out);
+}
+
+void SpatialIndex::TakeNearest(std::vector<SpatialHit>& hits, size_t k, std::vector<SpatialHit>& out)
+{
+    auto byDistance = [](const SpatialHit& a, const SpatialHit& b)
+    { return a.DistanceSq < b.DistanceSq || (a.DistanceSq == b.DistanceSq && a.Id < b.Id); };
+    const size_t take = std::min(k, hits.size());
+    std::partial_sort(hits.begin(), hits.begin() + static_cast<std::ptrdiff_t>(take), hits.end(), byDistance);
+    out.insert(out.end(), hits.begin(), hits.begin() + static_cast<std::ptrdiff_t>(take));
+}
+
+}  // namespace CS2Kit::Sdk
@@ -0,0 +1,71 @@
+#include "Sdk/SchemaFields.hpp"
+
+#include <CS2Kit/Core/Services.hpp>
+#include <CS2Kit/Sdk/Entity.hpp>
+#include <CS2Kit/Sdk/SpatialService.hpp>
+#include <algorithm>
+
+using CS2Kit::Core::Engine;
+
+namespace CS2Kit::Sdk
+{
+
+namespace
+{
+int EntityIdOf(uint32_t handle)
+{
+    return SpatialService::EntityIdBase + static_cast<int>(handle & 0x7FFF);
+}
+}  // namespace
+
+bool SpatialService::UpdateEntity(CEntityInstance* entity, uint32_t handle)
+{
+    if (!entity)
+    {
+        _index.Remove(EntityIdOf(handle));
+        return false;
+    }
+    void* sceneNode = Fields::SceneNode::Get(Fields::BodyComponent::Get(entity));
+    _index.Upsert(EntityIdOf(handle), Fields::SceneOrigin::Get(sceneNode));
+    return true;
+}
+
+void SpatialService::Update()
+{
+    Core::ProfileScope scope(Engine().Profiler, _probe);
+    auto& snapshot = Engine().Snapshot;
+    for (int slot = 0; slot < Core::MaxPlayers; ++slot)
+    {
+        if (snapshot.Alive(slot))
+            _index.Upsert(slot, snapshot.Origin(slot));
+        else
+            _index.Remove(slot);
+    }
+
+    // Tracked entities: a handle that no longer resolves belongs to a deleted entity.
+    auto& entities = Engine().Entities;
+    std::erase_if(_tracked, [&](uint32_t handle) { return !UpdateEntity(entities.ResolveEntityHandle(handle), handle); });
+}
+
+void SpatialService::Track(CEntityInstance* entity)
+{
+    uint32_t handle = Engine().Entities.GetEntityHandle(entity);
+    if (handle == Fields::InvalidHandle || std::ranges::find(_tracked, handle) != _tracked.end())
+        return;
+    _tracked.push_back(handle);
+}
+
+void SpatialService::Untrack(CEntityInstance* entity)
+{
+    uint32_t handle = Engine().Entities.GetEntityHandle(entity);
+    if (std::erase(_tracked, handle) > 0)
+        _index.Remove(EntityIdOf(handle));
+}
+
+void SpatialService::Clear()
+{
+    _tracked.clear();
+    _index.Clear();
+}
+
+}  // namespace CS2Kit::Sdk
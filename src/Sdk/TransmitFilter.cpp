@@ -1,9 +1,10 @@
-#include "Sdk/Schema.hpp"
+#include "Sdk/SchemaFields.hpp"
 
 #include <CS2Kit/Core/Services.hpp>
 #include <CS2Kit/Sdk/Entity.hpp>
 #include <CS2Kit/Sdk/GameData.hpp>
 #include <CS2Kit/Sdk/MemoryAccess.hpp>
+#include <CS2Kit/Sdk/PlayerSnapshot.hpp>
 #include <CS2Kit/Sdk/TransmitFilter.hpp>
 #include <cstdint>
 #include <entity2/entityinstance.h>
@@ -44,85 +45,58 @@ void AddIndex(HiddenPlayer& player, int index)
         player.PawnIndices[player.IndexCount++] = index;
 }
 
-void AddHandleVector(HiddenPlayer& player, void* base, int offset)
+// The vector is larger than the two members the view reads, so no size check.
+using MyWeapons = SchemaField<"CPlayer_WeaponServices", "m_hMyWeapons", HandleVectorView, 0>;
+using MyWearables = SchemaField<"CBaseCombatCharacter", "m_hMyWearables", HandleVectorView, 0>;
+
+void AddHandleVector(HiddenPlayer& player, const HandleVectorView* view)
 {
-    if (offset < 0)
-        return;
-    const auto* view = MemberPtr<const HandleVectorView>(base, offset);
-    if (!view->Elements)
+    if (!view || !view->Elements)
         return;
     auto& entities = Engine().Entities;
     for (int32_t i = 0; i < view->Count && i < MaxIndicesPerPlayer; ++i)
         AddIndex(player, entities.GetEntityIndex(entities.ResolveEntityHandle(view->Elements[i])));
 }
 
-CEntityInstance* GetCurrentPawn(int slot)
-{
-    auto* controller = Engine().Entities.GetPlayerController(slot);
-    if (!controller)
-        return nullptr;
-    // m_hPawn is the possessed pawn (observer pawn while dead/spectating), unlike m_hPlayerPawn.
-    int offset = Engine().Schema().GetOffset("CBasePlayerController", "m_hPawn", sizeof(uint32_t));
-    if (offset < 0)
-        return nullptr;
-    return Engine().Entities.ResolveEntityHandle(ReadAt<uint32_t>(controller, offset));
-}
+// CheckTransmit runs outside the frame's snapshot capture, so the snapshot's entity pointers may
+// already be freed (a kick, a changelevel). Only its handles are used here, resolved again.
 
 // True when `recipientSlot` is currently observing `hiddenPawn`; the pawn must keep
 // transmitting to that client or its spectator camera breaks.
 bool IsObservingPawn(int recipientSlot, CEntityInstance* hiddenPawn)
 {
-    auto* pawn = GetCurrentPawn(recipientSlot);
-    if (!pawn)
-        return false;
-
-    auto& schema = Engine().Schema();
-    int servicesOffset = schema.GetOffset("CBasePlayerPawn", "m_pObserverServices");
-    if (servicesOffset < 0)
-        return false;
-    auto* observerServices = ReadAt<void*>(pawn, servicesOffset);
+    auto& entities = Engine().Entities;
+    auto* current = entities.ResolveEntityHandle(Engine().Snapshot.CurrentPawnHandle(recipientSlot));
+    auto* observerServices = Fields::PawnObserverServices::Get(current);
     if (!observerServices)
         return false;
 
-    int targetOffset = schema.GetOffset("CPlayer_ObserverServices", "m_hObserverTarget");
-    if (targetOffset < 0)
-        return false;
-    auto targetHandle = ReadAt<uint32_t>(observerServices, targetOffset);
-    return Engine().Entities.ResolveEntityHandle(targetHandle) == hiddenPawn;
+    auto targetHandle = Fields::ObserverTarget::Get(observerServices, Fields::InvalidHandle);
+    return entities.ResolveEntityHandle(targetHandle) == hiddenPawn;
 }
 
 void CollectHiddenPlayer(int slot, bool pawnHidden, bool controllerHidden, HiddenPlayer& out)
 {
     out.Slot = slot;
 
-    auto* controller = Engine().Entities.GetPlayerController(slot);
+    auto& entities = Engine().Entities;
+    auto* controller = entities.GetPlayerController(slot);
     if (!controller)
         return;
 
     if (controllerHidden)
-        out.ControllerIndex = Engine().Entities.GetEntityIndex(controller);
+        out.ControllerIndex = entities.GetEntityIndex(controller);
 
     if (!pawnHidden)
         return;
 
-    auto& schema = Engine().Schema();
-    int pawnOffset = schema.GetOffset("CCSPlayerController", "m_hPlayerPawn");
-    if (pawnOffset < 0)
-        return;
-    out.Pawn = Engine().Entities.ResolveEntityHandle(ReadAt<uint32_t>(controller, pawnOffset));
+    out.Pawn = entities.ResolveEntityHandle(Engine().Snapshot.PawnHandle(slot));
     if (!out.Pawn)
         return;
 
-    AddIndex(out, Engine().Entities.GetEntityIndex(out.Pawn));
-
-    int weaponServicesOffset = schema.GetOffset("CBasePlayerPawn", "m_pWeaponServices");
-    if (weaponServicesOffset >= 0)
-    {
-        if (auto* weaponServices = ReadAt<void*>(out.Pawn, weaponServicesOffset))
-            AddHandleVector(out, weaponServices, schema.GetOffset("CPlayer_WeaponServices", "m_hMyWeapons"));
-    }
-
-    AddHandleVector(out, out.Pawn, schema.GetOffset("CBaseCombatCharacter", "m_hMyWearables"));
+    AddIndex(out, entities.GetEntityIndex(out.Pawn));
+    AddHandleVector(out, MyWeapons::Ptr(Fields::PawnWeaponServices::Get(out.Pawn)));
+    AddHandleVector(out, MyWearables::Ptr(out.Pawn));
 }
 
 }  // namespace
@@ -167,7 +141,18 @@ bool TransmitFilterService::IsControllerHidden(int slot) const
 
 void TransmitFilterService::SetEntityExclusive(int entityIndex, int beneficiarySlot)
 {
-    if (entityIndex <= 0 || !Core::IsValidSlot(beneficiarySlot))
+    if (Core::IsValidSlot(beneficiarySlot))
+        SetExclusive(entityIndex, beneficiarySlot);
+}
+
+void TransmitFilterService::HideEntity(int entityIndex)
+{
+    SetExclusive(entityIndex, NoBeneficiary);
+}
+
+void TransmitFilterService::SetExclusive(int entityIndex, int beneficiarySlot)
+{
+    if (entityIndex <= 0)
         return;
 
     for (auto& entry : _exclusive)
@@ -199,6 +184,7 @@ void TransmitFilterService::OnCheckTransmit(CCheckTransmitInfo** infoList, int i
 {
     if ((_activeCount == 0 && _exclusive.empty()) || _slotOffset < 0 || !infoList)
         return;
+    Core::ProfileScope scope(Engine().Profiler, _probe);
 
     // Entity indices are the same for every recipient (only the self/observer
     // exemptions differ per client), so gather them once per snapshot.
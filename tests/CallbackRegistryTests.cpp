@@ -2,6 +2,7 @@
 
 #include <CS2Kit/Core/CallbackRegistry.hpp>
 #include <functional>
+#include <vector>
 
 using CS2Kit::Core::CallbackRegistry;
 
@@ -16,26 +17,106 @@ TEST_CASE("CallbackRegistry Add returns increasing handles from 1")
     CHECK(!reg.Remove(a));  // already gone
 }
 
-TEST_CASE("Add with caller-supplied id shares one handle space across registries")
+TEST_CASE("Registries in distinct handle spaces never accept each other's handles")
 {
-    // Mirrors MovementHook: several registries behind one RemoveListener(id). A shared
-    // external counter must keep handles disjoint so removing one never hits another.
-    CallbackRegistry<std::function<void()>> a;
-    CallbackRegistry<std::function<void()>> b;
-    uint64_t next = 1;
+    // Mirrors MovementHook: several registries behind one RemoveListener(id). Distinct spaces
+    // must keep handles disjoint so removing one never hits another.
+    CallbackRegistry<std::function<void()>> a{1};
+    CallbackRegistry<std::function<void()>> b{2};
 
-    uint64_t idA = a.Add([] {}, next++);
-    uint64_t idB = b.Add([] {}, next++);
-    CHECK_EQ(idA, 1u);
-    CHECK_EQ(idB, 2u);
+    uint64_t idA = a.Add([] {});
+    uint64_t idB = b.Add([] {});
+    CHECK(idA != idB);  // same slot and generation in each; only the space differs
 
     // Removing idA from both registries (the RemoveListener pattern) must not touch b's entry.
     a.Remove(idA);
     b.Remove(idA);
     CHECK(a.Empty());
-    CHECK(!b.Empty());  // idB survived; per-registry counters would both have issued 1 and collided
+    CHECK(!b.Empty());  // idB survived; a shared space would have issued 1 to both and collided
 
     a.Remove(idB);
     b.Remove(idB);
     CHECK(b.Empty());
 }
+
+TEST_CASE("CallbackRegistry reuses slots under a new generation; stale handles stay dead")
+{
+    CallbackRegistry<int> reg;
+    uint64_t first = reg.Add(1);
+    reg.Remove(first);
+    uint64_t second = reg.Add(2);  // same slot, bumped generation
+
+    CHECK(second != first);
+    CHECK(reg.Find(first) == nullptr);
+    CHECK(!reg.Remove(first));
+    CHECK(reg.Find(second) != nullptr && *reg.Find(second) == 2);
+    CHECK_EQ(reg.Size(), 1u);
+}
+
+TEST_CASE("CallbackRegistry swap-remove keeps every other handle resolving")
+{
+    CallbackRegistry<int> reg;
+    std::vector<uint64_t> ids;
+    for (int i = 0; i < 8; ++i)
+        ids.push_back(reg.Add(i));
+
+    reg.Remove(ids[0]);
+    reg.Remove(ids[5]);
+    for (int i = 0; i < 8; ++i)
+    {
+        int* item = reg.Find(ids[i]);
+        if (i == 0 || i == 5)
+            CHECK(item == nullptr);
+        else
+            CHECK(item != nullptr && *item == i);
+    }
+}
+
+TEST_CASE("CallbackRegistry ForEach tolerates self-removal, removal of others, and adds")
+{
+    CallbackRegistry<std::function<void()>> reg;
+    std::vector<int> calls;
+    uint64_t a = 0, b = 0, c = 0;
+    a = reg.Add([&] {
+        calls.push_back(1);
+        reg.Remove(a);  // self: the closure must stay alive until it returns
+        reg.Remove(c);  // a later entry: must be skipped this walk
+        reg.Add([&] { calls.push_back(4); });
+        calls.push_back(11);  // still running safely after self-removal
+    });
+    b = reg.Add([&] { calls.push_back(2); });
+    c = reg.Add([&] { calls.push_back(3); });
+
+    reg.ForEach([](std::function<void()>& fn) { fn(); });
+    CHECK(calls == (std::vector<int>{1, 11, 2}));  // the add joins after the walk
+    CHECK_EQ(reg.Size(), 2u);
+    CHECK(reg.Find(b) != nullptr);
+
+    calls.clear();
+    reg.ForEach([](std::function<void()>& fn) { fn(); });
+    CHECK_EQ(calls.size(), 2u);  // b and the added entry
+}
+
+TEST_CASE("CallbackRegistry ForEach passes handles and survives Clear mid-walk")
+{
+    CallbackRegistry<int> reg;
+    uint64_t a = reg.Add(10);
+    reg.Add(20);
+
+    uint64_t seen = 0;
+    int visits = 0;
+    reg.ForEach([&](uint64_t id, int&) {
+        if (!seen)
+            seen = id;
+        ++visits;
+        reg.Clear();
+    });
+    CHECK_EQ(visits, 1);
+    CHECK(seen != 0);
+    CHECK(reg.Empty());
+    CHECK(reg.Find(a) == nullptr);
+
+    uint64_t fresh = reg.Add(30);
+    CHECK(fresh != a);
+    CHECK(reg.Find(fresh) != nullptr);
+}
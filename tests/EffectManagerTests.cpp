@@ -2,9 +2,16 @@
 
 #include <CS2Kit/Core/EffectManager.hpp>
 #include <CS2Kit/Core/Scheduler.hpp>
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
 
 using CS2Kit::Core::EffectManager;
 using CS2Kit::Core::EffectSpec;
+using CS2Kit::Core::ScheduledEffect;
 using CS2Kit::Core::Scheduler;
 
 namespace
@@ -134,3 +141,270 @@ TEST_CASE("EffectManager: out-of-range slots are no-ops")
     mgr.Cancel(-1, Disco);
     mgr.CancelAllForSlot(EffectManager::MaxSlots);  // must not crash
 }
+
+TEST_CASE("EffectManager: self-expiry clears IsActive and runs onStop once")
+{
+    Scheduler scheduler;
+    EffectManager mgr(scheduler);
+
+    int cancels = 0;
+    mgr.Apply(3, Disco, {.DurationMs = 1, .OnStop = [&] { ++cancels; }});
+    CHECK(mgr.IsActive(3, Disco));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    scheduler.OnGameFrame();
+    CHECK(!mgr.IsActive(3, Disco));
+    CHECK_EQ(cancels, 1);
+
+    mgr.Cancel(3, Disco);  // already expired: no second onStop
+    CHECK_EQ(cancels, 1);
+}
+
+TEST_CASE("EffectManager: re-Apply keeps only the new expiry")
+{
+    Scheduler scheduler;
+    EffectManager mgr(scheduler);
+
+    mgr.Apply(3, Disco, {.DurationMs = 1, .OnStop = [] {}});
+    mgr.Apply(3, Disco, {.OnStop = [] {}});  // permanent replacement
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    scheduler.OnGameFrame();
+    CHECK(mgr.IsActive(3, Disco));  // the first instance's timer must not cancel the second
+}
+
+TEST_CASE("EffectManager: ActiveMask and out-of-range ids")
+{
+    Scheduler scheduler;
+    EffectManager mgr(scheduler);
+
+    mgr.Apply(7, Disco, {.OnStop = [] {}});
+    mgr.Apply(7, 63, {.OnStop = [] {}});
+    mgr.Apply(7, EffectManager::MaxEffectIds, {.OnStop = [] {}});  // rejected
+    mgr.Apply(7, -1, {.OnStop = [] {}});
+    CHECK_EQ(mgr.ActiveMask(7), (uint64_t{1} << 63) | 1u);
+    CHECK(!mgr.IsActive(7, EffectManager::MaxEffectIds));
+    CHECK_EQ(mgr.ActiveMask(-1), uint64_t{0});
+}
+
+TEST_CASE("EffectManager: a sweep tolerates onStop cancelling and re-applying")
+{
+    Scheduler scheduler;
+    EffectManager mgr(scheduler);
+
+    int ghostStops = 0;
+    mgr.Apply(3, Ghost, {.RoundScoped = true, .OnStop = [&] { ++ghostStops; }});
+    mgr.Apply(3, Disco, {.RoundScoped = true, .OnStop = [&] {
+                             mgr.Cancel(3, Ghost);                   // sibling cancelled from inside the sweep
+                             mgr.Apply(3, 2, {.RoundScoped = true, .OnStop = [] {}});  // new effect mid-sweep
+                         }});
+
+    mgr.CancelRoundScoped();
+    CHECK_EQ(ghostStops, 1);
+    CHECK(!mgr.IsActive(3, Disco));
+    CHECK(!mgr.IsActive(3, Ghost));
+    CHECK(mgr.IsActive(3, 2));  // applied after the snapshot: survives this sweep
+}
+
+TEST_CASE("EffectManager: destruction runs the onStop of active effects")
+{
+    Scheduler scheduler;
+    int cancels = 0;
+    {
+        EffectManager mgr(scheduler);
+        mgr.Apply(3, Disco, {.DurationMs = 60000, .OnStop = [&] { ++cancels; }});
+        mgr.Apply(9, Ghost, {.OnStop = [&] { ++cancels; }});
+    }
+    CHECK_EQ(cancels, 2);
+    scheduler.OnGameFrame();  // the expiry timer was cancelled with its effect
+}
+
+TEST_CASE("EffectManager: batched effects share one timer per id and interval")
+{
+    Scheduler scheduler;
+    EffectManager mgr(scheduler);
+
+    std::vector<std::vector<int>> calls;
+    auto batch = [&](std::span<const int> slots) { calls.emplace_back(slots.begin(), slots.end()); };
+    const size_t baseline = scheduler.TimerCount();
+
+    for (int slot : {9, 2, 5})
+        mgr.Apply(slot, Disco, {.TickIntervalMs = 1, .OnStop = [] {}, .OnTickBatch = batch});
+    mgr.Apply(4, Disco, {.TickIntervalMs = 1000, .OnStop = [] {}, .OnTickBatch = batch});  // other interval
+    CHECK_EQ(scheduler.TimerCount(), baseline + 2);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(3));
+    scheduler.OnGameFrame();
+    CHECK_EQ(calls.size(), size_t{1});
+    CHECK(calls[0] == (std::vector<int>{2, 5, 9}));
+
+    mgr.Cancel(5, Disco);
+    std::this_thread::sleep_for(std::chrono::milliseconds(3));
+    scheduler.OnGameFrame();
+    CHECK_EQ(calls.size(), size_t{2});
+    CHECK(calls[1] == (std::vector<int>{2, 9}));
+
+    mgr.Cancel(2, Disco);
+    mgr.Cancel(9, Disco);
+    CHECK_EQ(scheduler.TimerCount(), baseline + 1);  // the 1 ms group is gone, 4's remains
+}
+
+TEST_CASE("EffectManager: batch keys keep differing bodies in separate groups")
+{
+    Scheduler scheduler;
+    EffectManager mgr(scheduler);
+
+    std::vector<int> red, blue;
+    mgr.Apply(1, Disco, {.TickIntervalMs = 1, .OnStop = [] {}, .OnTickBatch = [&](std::span<const int> slots) {
+                             red.insert(red.end(), slots.begin(), slots.end());
+                         }, .BatchKey = 0});
+    mgr.Apply(2, Disco, {.TickIntervalMs = 1, .OnStop = [] {}, .OnTickBatch = [&](std::span<const int> slots) {
+                             blue.insert(blue.end(), slots.begin(), slots.end());
+                         }, .BatchKey = 1});
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(3));
+    scheduler.OnGameFrame();
+    CHECK(red == (std::vector<int>{1}));
+    CHECK(blue == (std::vector<int>{2}));
+
+    // Cancelling leaves the member's own group, not the first one of its id and interval.
+    const size_t before = scheduler.TimerCount();
+    mgr.Cancel(2, Disco);
+    CHECK_EQ(scheduler.TimerCount(), before - 1);
+    CHECK(mgr.IsActive(1, Disco));
+}
+
+TEST_CASE("EffectManager: an onStop re-applying a batched spec does not survive the outer Apply")
+{
+    Scheduler scheduler;
+    EffectManager mgr(scheduler);
+
+    std::vector<int> ticked;
+    auto batch = [&](std::span<const int> slots) { ticked.insert(ticked.end(), slots.begin(), slots.end()); };
+    const size_t baseline = scheduler.TimerCount();
+
+    int innerStops = 0;
+    bool reapplied = false;
+    mgr.Apply(3, Disco, {.OnStop = [&] {
+                             if (std::exchange(reapplied, true))
+                                 return;
+                             mgr.Apply(3, Disco, {.TickIntervalMs = 1, .OnStop = [&] { ++innerStops; },
+                                                  .OnTickBatch = batch});
+                         }});
+    mgr.Apply(3, Disco, {.OnStop = [] {}});  // unbatched: the batched instance must not linger in its group
+
+    CHECK_EQ(innerStops, 1);
+    CHECK(mgr.IsActive(3, Disco));
+    CHECK_EQ(scheduler.TimerCount(), baseline);
+    std::this_thread::sleep_for(std::chrono::milliseconds(3));
+    scheduler.OnGameFrame();
+    CHECK(ticked.empty());
+
+    mgr.Cancel(3, Disco);
+    CHECK(!mgr.IsActive(3, Disco));
+}
+
+TEST_CASE("EffectManager: batched members expire and stop individually")
+{
+    Scheduler scheduler;
+    EffectManager mgr(scheduler);
+
+    int stops = 0;
+    std::vector<int> lastSlots;
+    auto batch = [&](std::span<const int> slots) { lastSlots.assign(slots.begin(), slots.end()); };
+    mgr.Apply(1, Ghost, {.TickIntervalMs = 1, .DurationMs = 1, .OnStop = [&] { ++stops; }, .OnTickBatch = batch});
+    mgr.Apply(2, Ghost, {.TickIntervalMs = 1, .DurationMs = 60000, .OnStop = [&] { ++stops; }, .OnTickBatch = batch});
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    scheduler.OnGameFrame();
+    CHECK(!mgr.IsActive(1, Ghost));
+    CHECK(mgr.IsActive(2, Ghost));
+    CHECK_EQ(stops, 1);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(3));
+    scheduler.OnGameFrame();
+    CHECK(lastSlots == std::vector<int>{2});
+}
+
+TEST_CASE("EffectManager: a batch body may cancel its own members")
+{
+    Scheduler scheduler;
+    EffectManager mgr(scheduler);
+
+    int stops = 0;
+    int ticks = 0;
+    auto batch = [&](std::span<const int> slots) {
+        ++ticks;
+        for (int slot : slots)
+            mgr.Cancel(slot, Disco);  // e.g. the target died mid-burn
+    };
+    const size_t baseline = scheduler.TimerCount();
+    mgr.Apply(1, Disco, {.TickIntervalMs = 1, .OnStop = [&] { ++stops; }, .OnTickBatch = batch});
+    mgr.Apply(2, Disco, {.TickIntervalMs = 1, .OnStop = [&] { ++stops; }, .OnTickBatch = batch});
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(3));
+    scheduler.OnGameFrame();
+    CHECK_EQ(ticks, 1);
+    CHECK_EQ(stops, 2);
+    CHECK_EQ(scheduler.TimerCount(), baseline);
+}
+
+TEST_CASE("ScheduledEffect: pool slots are recycled without growing")
+{
+    Scheduler scheduler;
+    ScheduledEffect::Pool pool(2);
+
+    int stops = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        ScheduledEffect a(pool, scheduler, 0, 0, {}, [&] { ++stops; });
+        ScheduledEffect b(pool, scheduler, 0, 0, {}, [&] { ++stops; });
+        CHECK_EQ(pool.InUse(), size_t{2});
+    }
+    CHECK_EQ(stops, 200);
+    CHECK_EQ(pool.InUse(), size_t{0});
+    CHECK_EQ(pool.Capacity(), size_t{2});
+}
+
+TEST_CASE("ScheduledEffect: a stopped handle stays inactive after its slot is reused")
+{
+    Scheduler scheduler;
+    ScheduledEffect::Pool pool(1);
+
+    ScheduledEffect first(pool, scheduler, 0, 0, {}, {});
+    first.Stop();
+    int secondStops = 0;
+    ScheduledEffect second(pool, scheduler, 0, 0, {}, [&] { ++secondStops; });
+
+    CHECK(!first.Active());
+    CHECK(second.Active());
+    first.Stop();  // stale: must not reach the slot's new occupant
+    CHECK(second.Active());
+    CHECK_EQ(secondStops, 0);
+}
+
+TEST_CASE("ScheduledEffect: an old auto-stop timer cannot end the slot's next effect")
+{
+    Scheduler scheduler;
+    ScheduledEffect::Pool pool(1);
+
+    ScheduledEffect timed(pool, scheduler, 0, 1, {}, {});
+    timed.Stop();  // releases the slot; its 1ms stop timer is cancelled with it
+    ScheduledEffect next(pool, scheduler, 0, 0, {}, {});
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(3));
+    scheduler.OnGameFrame();
+    CHECK(next.Active());
+}
+
+TEST_CASE("ScheduledEffect: the pool grows past its capacity when it has to")
+{
+    Scheduler scheduler;
+    ScheduledEffect::Pool pool(1);
+
+    ScheduledEffect a(pool, scheduler, 0, 0, {}, {});
+    ScheduledEffect b(pool, scheduler, 0, 0, {}, {});
+    CHECK(a.Active());
+    CHECK(b.Active());
+    CHECK_EQ(pool.Capacity(), size_t{2});
+}
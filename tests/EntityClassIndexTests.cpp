@@ -0,0 +1,68 @@
+#include "MicroTest.hpp"
+
+#include <CS2Kit/Sdk/EntityClassIndex.hpp>
+#include <algorithm>
+#include <vector>
+
+using CS2Kit::Sdk::EntityClassIndex;
+
+namespace
+{
+std::vector<int> Visit(const EntityClassIndex& index, std::string_view pattern)
+{
+    std::vector<int> out;
+    index.ForEach(pattern, [&](int entity) { out.push_back(entity); });
+    std::ranges::sort(out);
+    return out;
+}
+}  // namespace
+
+TEST_CASE("EntityClassIndex: exact and prefix patterns visit only their matches")
+{
+    EntityClassIndex index;
+    index.Add(70, "weapon_ak47");
+    index.Add(71, "weapon_awp");
+    index.Add(72, "weaponry_rack");
+    index.Add(5, "cs_player_controller");
+    index.Add(80, "weapon_ak47");
+
+    CHECK(Visit(index, "weapon_ak47") == std::vector<int>({70, 80}));
+    CHECK(Visit(index, "weapon_*") == std::vector<int>({70, 71, 80}));
+    CHECK(Visit(index, "weapon*") == std::vector<int>({70, 71, 72, 80}));
+    CHECK(Visit(index, "*").size() == 5u);
+    CHECK(Visit(index, "weapon_m4a1").empty());
+    CHECK_EQ(index.Count("weapon_*"), size_t{3});
+    CHECK_EQ(index.Size(), size_t{5});
+}
+
+TEST_CASE("EntityClassIndex: removal swaps the last entry in and keeps positions valid")
+{
+    EntityClassIndex index;
+    for (int i = 1; i <= 4; ++i)
+        index.Add(i, "prop_dynamic");
+
+    index.Remove(1);  // first slot: 4 moves into it
+    index.Remove(4);  // the moved entry must still be found
+    index.Remove(4);  // repeated removal is a no-op
+    index.Remove(999);
+
+    CHECK(Visit(index, "prop_dynamic") == std::vector<int>({2, 3}));
+    CHECK(!index.Contains(1));
+    CHECK(index.Contains(3));
+    CHECK_EQ(index.Size(), size_t{2});
+}
+
+TEST_CASE("EntityClassIndex: re-adding an index moves it to the new class")
+{
+    EntityClassIndex index;
+    index.Add(12, "info_target");
+    index.Add(12, "point_worldtext");
+
+    CHECK(Visit(index, "info_target").empty());
+    CHECK(Visit(index, "point_worldtext") == std::vector<int>({12}));
+    CHECK_EQ(index.Size(), size_t{1});
+
+    index.Clear();
+    CHECK(!index.Contains(12));
+    CHECK_EQ(index.Count("*"), size_t{0});
+}
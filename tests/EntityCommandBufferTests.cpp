@@ -0,0 +1,87 @@
+#include "MicroTest.hpp"
+
+#include <CS2Kit/Sdk/EntityCommandBuffer.hpp>
+#include <string>
+#include <vector>
+
+using CS2Kit::Sdk::EntityCommandBuffer;
+
+namespace
+{
+EntityCommandBuffer::Input MakeInput(uint32_t target, const char* name, const char* param = "")
+{
+    return {.Target = target, .Name = name, .Param = param};
+}
+
+std::vector<std::string> Names(const EntityCommandBuffer::Batch& batch)
+{
+    std::vector<std::string> names;
+    for (const auto& input : batch.Inputs)
+        names.push_back(std::to_string(input.Target) + ":" + input.Name + "(" + input.Param + ")");
+    return names;
+}
+}  // namespace
+
+TEST_CASE("EntityCommandBuffer: identical inputs coalesce, distinct ones keep queue order")
+{
+    EntityCommandBuffer buffer;
+    buffer.QueueInput(MakeInput(7, "Start"));
+    buffer.QueueInput(MakeInput(8, "FollowEntity", "!activator"));
+    buffer.QueueInput(MakeInput(7, "Start"));
+    buffer.QueueInput(MakeInput(7, "SetGlowColor", "255 0 0"));
+    buffer.QueueInput(MakeInput(7, "SetGlowColor", "0 255 0"));  // different param: both fire
+    buffer.QueueInput({.Target = 7, .Name = "SetScale", .Value = 2.0f, .IsFloat = true});
+    buffer.QueueInput({.Target = 7, .Name = "SetScale", .Value = 2.0f, .IsFloat = true});
+    buffer.QueueInput(MakeInput(EntityCommandBuffer::NoEntity, "Start"));
+    CHECK_EQ(buffer.Pending(), size_t{5});
+
+    auto batch = buffer.Take();
+    CHECK(Names(batch) == std::vector<std::string>({"7:Start()", "8:FollowEntity(!activator)",
+                                                    "7:SetGlowColor(255 0 0)", "7:SetGlowColor(0 255 0)",
+                                                    "7:SetScale()"}));
+    CHECK_EQ(batch.Counts.Inputs, uint64_t{5});
+    CHECK_EQ(batch.Counts.Coalesced, uint64_t{2});
+    CHECK_EQ(buffer.Pending(), size_t{0});
+}
+
+TEST_CASE("EntityCommandBuffer: removal drops earlier and later commands for the entity")
+{
+    EntityCommandBuffer buffer;
+    buffer.QueueInput(MakeInput(3, "Start"));
+    buffer.QueueKeyValue(3, "targetname", "doomed");
+    buffer.QueueInput(MakeInput(4, "Start"));
+    buffer.QueueRemove(3);
+    buffer.QueueRemove(3);
+    buffer.QueueInput(MakeInput(3, "Stop"));
+    buffer.QueueKeyValue(4, "rendermode", "1");
+    buffer.QueueKeyValue(4, "rendermode", "10");  // last value per key wins
+
+    auto batch = buffer.Take();
+    CHECK(Names(batch) == std::vector<std::string>({"4:Start()"}));
+    CHECK_EQ(batch.KeyValues.size(), size_t{1});
+    CHECK_EQ(batch.KeyValues[0].Value, std::string("10"));
+    CHECK(batch.Removals == std::vector<uint32_t>({3}));
+    CHECK_EQ(batch.Counts.Dropped, uint64_t{3});
+    CHECK_EQ(batch.Counts.Coalesced, uint64_t{1});
+
+    // The next frame starts clean: entity 3's removal no longer swallows its commands.
+    buffer.QueueInput(MakeInput(3, "Start"));
+    CHECK_EQ(buffer.Take().Inputs.size(), size_t{1});
+}
+
+TEST_CASE("EntityCommandBuffer: spawns keep their order and callbacks")
+{
+    EntityCommandBuffer buffer;
+    int spawned = 0;
+    buffer.QueueSpawn("info_particle_system", nullptr, [&](CEntityInstance*) { ++spawned; });
+    buffer.QueueSpawn("env_beam", nullptr);
+
+    auto batch = buffer.Take();
+    CHECK_EQ(batch.Spawns.size(), size_t{2});
+    CHECK_EQ(batch.Spawns[0].ClassName, std::string("info_particle_system"));
+    CHECK_EQ(batch.Spawns[1].ClassName, std::string("env_beam"));
+    CHECK(!batch.Spawns[1].OnSpawned);
+    batch.Spawns[0].OnSpawned(nullptr);
+    CHECK_EQ(spawned, 1);
+    CHECK_EQ(batch.Counts.Spawns, uint64_t{2});
+}
@@ -0,0 +1,111 @@
+#include "MicroTest.hpp"
+
+#include <CS2Kit/Sdk/EntityRange.hpp>
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using CS2Kit::Sdk::EntityRange;
+using CS2Kit::Sdk::IdentityLayout;
+
+namespace
+{
+// Stand-in CEntityIdentity: only the fields the range reads, in a different order than the
+// SDK's so the layout offsets are actually exercised.
+struct FakeIdentity
+{
+    uint32_t Handle = 0xFFFFFFFFu;
+    const char* Name = nullptr;
+    CEntityInstance* Instance = nullptr;
+};
+
+constexpr IdentityLayout FakeLayout{
+    .Stride = sizeof(FakeIdentity),
+    .InstanceOffset = offsetof(FakeIdentity, Instance),
+    .HandleOffset = offsetof(FakeIdentity, Handle),
+    .NameOffset = offsetof(FakeIdentity, Name),
+};
+
+constexpr int ChunkSize = 4;
+
+struct FakeList
+{
+    std::array<std::vector<FakeIdentity>, 3> Storage;
+    std::array<void*, 3> Chunks{};
+    std::array<std::byte, 64> Instances{};  // distinct addresses to hand out as entities
+
+    void Place(int index, const char* name)
+    {
+        auto& chunk = Storage[index / ChunkSize];
+        if (chunk.empty())
+            chunk.resize(ChunkSize);
+        Chunks[index / ChunkSize] = chunk.data();
+        chunk[index % ChunkSize] = {static_cast<uint32_t>(index) | (7u << 15), name,
+                                    reinterpret_cast<CEntityInstance*>(&Instances[index])};
+    }
+
+    EntityRange Range(const char* name = nullptr)
+    {
+        return EntityRange(Chunks.data(), static_cast<int>(Chunks.size()), ChunkSize, FakeLayout, name);
+    }
+};
+
+std::vector<int> Indices(const EntityRange& range)
+{
+    std::vector<int> out;
+    for (auto it = range.begin(); it != range.end(); ++it)
+        out.push_back(it.Index());
+    return out;
+}
+}  // namespace
+
+TEST_CASE("EntityRange: walks live identities in order and skips missing chunks")
+{
+    FakeList list;
+    list.Place(1, "worldent");
+    list.Place(2, "info_target");
+    list.Place(9, "info_target");  // chunk 1 is never allocated
+    list.Place(11, "prop_dynamic");
+
+    CHECK(Indices(list.Range()) == std::vector<int>({1, 2, 9, 11}));
+
+    int count = 0;
+    for (CEntityInstance* entity : list.Range())
+    {
+        CHECK(entity != nullptr);
+        ++count;
+    }
+    CHECK_EQ(count, 4);
+}
+
+TEST_CASE("EntityRange: a freed slot (stale handle or no instance) is skipped")
+{
+    FakeList list;
+    list.Place(0, "a");
+    list.Place(1, "a");
+    list.Place(2, "a");
+    list.Storage[0][1].Handle = 0xFFFFFFFFu;  // freed: the handle no longer carries index 1
+    list.Storage[0][2].Instance = nullptr;
+
+    CHECK(Indices(list.Range()) == std::vector<int>({0}));
+}
+
+TEST_CASE("EntityRange: the name filter matches by content first, then by interned pointer")
+{
+    static const char door[] = "func_door";
+    std::string lookalike = "func_door";  // same text, different pointer: not the interned name
+
+    FakeList list;
+    list.Place(3, door);
+    list.Place(5, "func_button");
+    list.Place(6, door);
+    list.Place(10, lookalike.c_str());
+
+    // The query string itself is never the interned pointer; the first match teaches it.
+    std::string query = "func_door";
+    CHECK(Indices(list.Range(query.c_str())) == std::vector<int>({3, 6}));
+    CHECK(Indices(list.Range("func_button")) == std::vector<int>({5}));
+    CHECK(Indices(list.Range("weapon_ak47")).empty());
+    CHECK(Indices(EntityRange()).empty());
+}
@@ -0,0 +1,42 @@
+#include "MicroTest.hpp"
+
+#include <CS2Kit/Sdk/EntitySpawnTemplate.hpp>
+#include <string>
+
+using CS2Kit::Sdk::EntitySpawnTemplate;
+using Kind = EntitySpawnTemplate::ValueKind;
+
+TEST_CASE("EntitySpawnTemplate: entries keep insertion order and typed values")
+{
+    auto tmpl = EntitySpawnTemplate("prop_dynamic")
+                    .Set("model", "models/a.vmdl")
+                    .Set("spawnflags", 256)
+                    .Set("renderamt", 1.5f)
+                    .Set("solid", false)
+                    .SetVector("origin", {1.0f, 2.0f, 3.0f})
+                    .SetColor("glowcolor", 255, 128, 0);
+
+    CHECK_EQ(tmpl.ClassName(), std::string("prop_dynamic"));
+    const auto& entries = tmpl.Entries();
+    CHECK_EQ(entries.size(), size_t{6});
+    CHECK_EQ(entries[0].Key, std::string("model"));
+    CHECK(entries[0].Kind == Kind::String);
+    CHECK_EQ(entries[1].Int, 256);
+    CHECK(entries[3].Kind == Kind::Bool);
+    CHECK_EQ(entries[3].Int, 0);
+    CHECK_EQ(entries[4].Vector.z, 3.0f);
+    CHECK_EQ(static_cast<int>(entries[5].Color[3]), 255);
+}
+
+TEST_CASE("EntitySpawnTemplate: setting a key again replaces it in place")
+{
+    auto tmpl = EntitySpawnTemplate("env_beam").Set("life", 1).Set("width", 2.0f).Set("life", "0.5");
+
+    CHECK_EQ(tmpl.Entries().size(), size_t{2});
+    CHECK_EQ(tmpl.Entries()[0].Key, std::string("life"));
+    CHECK(tmpl.Entries()[0].Kind == Kind::String);
+    CHECK_EQ(tmpl.Entries()[0].Text, std::string("0.5"));
+    CHECK_EQ(tmpl.Entries()[0].Int, 0);  // the old int value does not linger
+    CHECK(tmpl.Find("width") != nullptr);
+    CHECK(tmpl.Find("missing") == nullptr);
+}
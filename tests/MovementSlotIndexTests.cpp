@@ -0,0 +1,67 @@
+#include "MicroTest.hpp"
+
+#include <CS2Kit/Sdk/MovementHook.hpp>
+#include <array>
+
+using CS2Kit::Sdk::MovementSlotIndex;
+
+namespace
+{
+// Stand-in movement services: slot i's pawn owns services[i] when present[i].
+struct Players
+{
+    std::array<int, 64> services{};
+    std::array<bool, 64> present{};
+    int fills = 0;
+
+    auto Source()
+    {
+        return [this](int slot) -> const void* {
+            ++fills;
+            return present[slot] ? &services[slot] : nullptr;
+        };
+    }
+};
+}  // namespace
+
+TEST_CASE("MovementSlotIndex: resolves slots from one fill per frame")
+{
+    Players players;
+    players.present[3] = players.present[40] = true;
+    MovementSlotIndex index;
+
+    CHECK_EQ(index.Find(&players.services[3], 1, players.Source()), 3);
+    CHECK_EQ(index.Find(&players.services[40], 1, players.Source()), 40);
+    CHECK_EQ(players.fills, 64);
+    CHECK_EQ(index.Find(nullptr, 1, players.Source()), -1);
+}
+
+TEST_CASE("MovementSlotIndex: a miss does not refill within the frame")
+{
+    Players players;
+    players.present[5] = true;
+    MovementSlotIndex index;
+
+    CHECK_EQ(index.Find(&players.services[5], 7, players.Source()), 5);
+    players.present[9] = true;  // spawned after this frame's fill
+    for (int i = 0; i < 10; ++i)
+        CHECK_EQ(index.Find(&players.services[9], 7, players.Source()), -1);
+    CHECK_EQ(players.fills, 64);
+
+    // The next frame sees it, and a pawn that went away stops resolving.
+    players.present[5] = false;
+    CHECK_EQ(index.Find(&players.services[9], 8, players.Source()), 9);
+    CHECK_EQ(index.Find(&players.services[5], 8, players.Source()), -1);
+    CHECK_EQ(players.fills, 128);
+}
+
+TEST_CASE("MovementSlotIndex: Clear forces a refill in the same frame")
+{
+    Players players;
+    MovementSlotIndex index;
+    CHECK_EQ(index.Find(&players.services[2], 1, players.Source()), -1);
+
+    players.present[2] = true;
+    index.Clear();
+    CHECK_EQ(index.Find(&players.services[2], 1, players.Source()), 2);
+}
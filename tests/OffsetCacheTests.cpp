@@ -0,0 +1,143 @@
+#include "MicroTest.hpp"
+
+#include <CS2Kit/Sdk/OffsetCache.hpp>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <string_view>
+
+using CS2Kit::Sdk::OffsetCache;
+
+namespace
+{
+// Build ids the "loaded" modules report; tests edit it to simulate a game update.
+std::map<std::string, std::string, std::less<>> g_builds;
+
+OffsetCache MakeCache()
+{
+    return OffsetCache([](std::string_view module) {
+        auto it = g_builds.find(module);
+        return it != g_builds.end() ? it->second : std::string{};
+    });
+}
+
+std::filesystem::path TempCachePath(const char* name)
+{
+    auto dir = std::filesystem::temp_directory_path() / "cs2kit-offset-cache-tests";
+    std::filesystem::create_directories(dir);
+    auto path = dir / name;
+    std::filesystem::remove(path);
+    return path;
+}
+}  // namespace
+
+TEST_CASE("OffsetCache: signatures and fields round-trip through the file")
+{
+    g_builds = {{"server", "aaaa"}, {"engine2", "bbbb"}};
+    const auto path = TempCachePath("roundtrip.json");
+
+    auto cache = MakeCache();
+    cache.StoreSignature("server", "UTIL_Remove", 0x1234);
+    cache.StoreSignature("engine2", "GameEntitySystem", 0x42);
+    cache.StoreField("CBaseEntity", "m_iHealth", {.Offset = 0x344, .Size = 4});
+    CHECK(cache.Dirty());
+    CHECK(cache.Save(path));
+    CHECK(!cache.Dirty());
+
+    auto loaded = MakeCache();
+    CHECK(loaded.Load(path));
+    CHECK_EQ(loaded.FindSignature("server", "UTIL_Remove").value_or(0), uint64_t{0x1234});
+    CHECK_EQ(loaded.FindSignature("engine2", "GameEntitySystem").value_or(0), uint64_t{0x42});
+    CHECK(!loaded.FindSignature("server", "Missing"));
+    auto field = loaded.FindField("CBaseEntity", "m_iHealth");
+    CHECK(field.has_value());
+    CHECK_EQ(field->Offset, 0x344);
+    CHECK_EQ(field->Size, 4);
+    CHECK_EQ(loaded.StaleModules(), size_t{0});
+    CHECK(!loaded.Dirty());
+}
+
+TEST_CASE("OffsetCache: a changed module build drops only that module's entries")
+{
+    g_builds = {{"server", "aaaa"}, {"engine2", "bbbb"}};
+    const auto path = TempCachePath("stale.json");
+
+    auto cache = MakeCache();
+    cache.StoreSignature("server", "UTIL_Remove", 0x1234);
+    cache.StoreSignature("engine2", "GameEntitySystem", 0x42);
+    cache.StoreField("CBaseEntity", "m_iHealth", {.Offset = 0x344, .Size = 4});
+    CHECK(cache.Save(path));
+
+    g_builds["server"] = "cccc";  // game update rebuilt libserver
+    auto loaded = MakeCache();
+    CHECK(loaded.Load(path));
+    CHECK_EQ(loaded.StaleModules(), size_t{1});
+    CHECK(!loaded.FindSignature("server", "UTIL_Remove"));
+    CHECK(!loaded.FindField("CBaseEntity", "m_iHealth"));  // schema rides on the server build
+    CHECK_EQ(loaded.FindSignature("engine2", "GameEntitySystem").value_or(0), uint64_t{0x42});
+    CHECK(loaded.Dirty());
+
+    // Rediscovered entries are filed under the new build and survive the next load.
+    loaded.StoreSignature("server", "UTIL_Remove", 0x5678);
+    CHECK(loaded.Save(path));
+    auto reloaded = MakeCache();
+    CHECK(reloaded.Load(path));
+    CHECK_EQ(reloaded.FindSignature("server", "UTIL_Remove").value_or(0), uint64_t{0x5678});
+}
+
+TEST_CASE("OffsetCache: missing, garbled and other-version files load empty")
+{
+    g_builds = {{"server", "aaaa"}};
+    auto cache = MakeCache();
+    CHECK(!cache.Load(TempCachePath("absent.json")));
+
+    const auto garbled = TempCachePath("garbled.json");
+    std::ofstream(garbled) << "{ not json";
+    CHECK(!cache.Load(garbled));
+    CHECK_EQ(cache.SignatureCount(), size_t{0});
+
+    const auto future = TempCachePath("future.json");
+    std::ofstream(future) << R"({"version": 999, "modules": {"server": {"build": "aaaa", "signatures": {"X": 1}}}})";
+    CHECK(!cache.Load(future));
+    CHECK(!cache.FindSignature("server", "X"));
+}
+
+TEST_CASE("OffsetCache: unchanged stores keep it clean; unloaded modules are not cached")
+{
+    g_builds = {{"server", "aaaa"}};
+    const auto path = TempCachePath("clean.json");
+
+    auto cache = MakeCache();
+    cache.StoreSignature("server", "A", 1);
+    CHECK(cache.Save(path));
+    cache.StoreSignature("server", "A", 1);
+    CHECK(!cache.Dirty());
+
+    cache.StoreSignature("client", "B", 2);  // no build id: nothing to key it on
+    CHECK(!cache.FindSignature("client", "B"));
+    CHECK(!cache.Dirty());
+
+    cache.ForgetSignature("server", "A");
+    CHECK(cache.Dirty());
+    CHECK(!cache.FindSignature("server", "A"));
+}
+
+TEST_CASE("OffsetCache: negative field entries are dropped on load; ForgetField removes one")
+{
+    g_builds = {{"server", "aaaa"}};
+    const auto path = TempCachePath("edited.json");
+    std::ofstream(path) << R"({"version": 1, "modules": {"server": {"build": "aaaa", "signatures": {}}},)"
+                        << R"( "schema": {"CBaseEntity::m_iHealth": [836, 4], "CBaseEntity::m_iTeamNum": [-8, 1]}})";
+
+    auto cache = MakeCache();
+    CHECK(cache.Load(path));
+    CHECK(!cache.FindField("CBaseEntity", "m_iTeamNum"));
+    CHECK_EQ(cache.FieldCount(), size_t{1});
+    CHECK(cache.Dirty());  // the next save writes the file back without the bad entry
+
+    CHECK(cache.Save(path));
+    cache.ForgetField("CBaseEntity", "m_iHealth");
+    CHECK(cache.Dirty());
+    CHECK(!cache.FindField("CBaseEntity", "m_iHealth"));
+}
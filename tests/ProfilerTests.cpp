@@ -0,0 +1,172 @@
+#include "MicroTest.hpp"
+
+#include <CS2Kit/Core/Profiler.hpp>
+#include <CS2Kit/Core/Scheduler.hpp>
+#include <algorithm>
+#include <string>
+
+using CS2Kit::Core::ProbePoint;
+using CS2Kit::Core::Profiler;
+using CS2Kit::Core::ProfileScope;
+using CS2Kit::Core::Scheduler;
+
+TEST_CASE("Profiler: probes are interned by name")
+{
+    Profiler profiler;
+    auto a = profiler.Probe("menus.frame");
+    auto b = profiler.Probe("transmit.check");
+    CHECK(a != 0);
+    CHECK(a != b);
+    CHECK_EQ(profiler.Probe("menus.frame"), a);
+}
+
+TEST_CASE("Profiler: percentiles and max come from the rolling window")
+{
+    Profiler profiler;
+    profiler.SetEnabled(true);
+    auto id = profiler.Probe("probe");
+    for (int i = 1; i <= 100; ++i)
+        profiler.Record(id, 0, i * 1000);  // 1..100 us
+
+    auto stats = profiler.Snapshot();
+    CHECK_EQ(stats.size(), size_t{1});
+    CHECK_EQ(stats[0].Calls, uint64_t{100});
+    CHECK_EQ(stats[0].P50Us, 51.0);
+    CHECK_EQ(stats[0].P99Us, 100.0);
+    CHECK_EQ(stats[0].MaxUs, 100.0);
+
+    // A full window of fast samples pushes the slow ones out.
+    for (size_t i = 0; i < Profiler::WindowSize; ++i)
+        profiler.Record(id, 0, 2000);
+    stats = profiler.Snapshot();
+    CHECK_EQ(stats[0].Window, Profiler::WindowSize);
+    CHECK_EQ(stats[0].MaxUs, 2.0);
+    CHECK_EQ(stats[0].P99Us, 2.0);
+}
+
+TEST_CASE("Profiler: snapshot is ordered by window time and Reset keeps ids")
+{
+    Profiler profiler;
+    profiler.SetEnabled(true);
+    auto light = profiler.Probe("light");
+    auto heavy = profiler.Probe("heavy");
+    profiler.Record(light, 0, 1000);
+    profiler.Record(heavy, 0, 50000);
+
+    auto stats = profiler.Snapshot(1);
+    CHECK_EQ(stats.size(), size_t{1});
+    CHECK_EQ(stats[0].Name, std::string("heavy"));
+
+    profiler.Reset();
+    CHECK(profiler.Snapshot().empty());
+    CHECK_EQ(profiler.Probe("heavy"), heavy);
+}
+
+TEST_CASE("Profiler: scopes record only while enabled")
+{
+    Profiler profiler;
+    ProbePoint point{"scoped"};
+    {
+        ProfileScope scope(profiler, point);
+    }
+    CHECK(profiler.Snapshot().empty());
+
+    profiler.SetEnabled(true);
+    {
+        ProfileScope scope(profiler, point);
+    }
+    auto stats = profiler.Snapshot();
+    CHECK_EQ(stats.size(), size_t{1});
+    CHECK_EQ(stats[0].Name, std::string("scoped"));
+}
+
+TEST_CASE("Profiler: scheduler timers are keyed by registration site")
+{
+    Profiler profiler;
+    Scheduler sched;
+    sched.SetProfiler(&profiler);
+    profiler.SetEnabled(true);
+
+    const int line = __LINE__ + 1;
+    sched.EveryFrame([] {});
+    sched.OnGameFrame();
+    sched.OnGameFrame();
+
+    auto stats = profiler.Snapshot();
+    auto named = [&](const std::string& name) {
+        return std::find_if(stats.begin(), stats.end(), [&](const auto& s) { return s.Name == name; });
+    };
+    auto timer = named("timer ProfilerTests.cpp:" + std::to_string(line));
+    CHECK(timer != stats.end());
+    CHECK(timer != stats.end() && timer->Calls == 2);
+    CHECK(named("scheduler.frame") != stats.end());
+}
+
+TEST_CASE("Profiler: a capture covers the requested frames and then finishes")
+{
+    Profiler profiler;
+    Scheduler sched;
+    sched.SetProfiler(&profiler);
+    sched.EveryFrame([] {});
+
+    CHECK(!profiler.Active());
+    profiler.StartCapture(3);
+    CHECK(profiler.Active());
+    CHECK(!profiler.Enabled());
+
+    for (int i = 0; i < 5; ++i)
+    {
+        profiler.BeginFrame();
+        sched.OnGameFrame();
+        profiler.EndFrame();
+    }
+    CHECK(!profiler.Capturing());
+    CHECK(!profiler.Active());
+    CHECK(profiler.Snapshot().empty());  // stats stay off: capturing does not enable them
+
+    auto capture = profiler.TakeCapture();
+    CHECK(capture.has_value());
+    CHECK(!profiler.TakeCapture().has_value());
+    CHECK_EQ(capture->Frames, uint32_t{3});
+    CHECK_EQ(capture->Dropped, uint64_t{0});
+
+    size_t frames = 0;
+    for (const auto& span : capture->Spans)
+        if (capture->Names[span.Probe - 1] == "GameFrame")
+            ++frames;
+    CHECK_EQ(frames, size_t{3});
+    // Per frame: the timer, scheduler.frame, GameFrame.
+    CHECK_EQ(capture->Spans.size(), size_t{9});
+}
+
+TEST_CASE("Profiler: the capture ring keeps the newest spans")
+{
+    Profiler profiler;
+    auto id = profiler.Probe("spam");
+    profiler.StartCapture(1);
+    const size_t total = Profiler::TraceCapacity + 10;
+    for (size_t i = 0; i < total; ++i)
+        profiler.Record(id, static_cast<int64_t>(i), 1);
+    profiler.StopCapture();
+
+    auto capture = profiler.TakeCapture();
+    CHECK(capture.has_value());
+    CHECK_EQ(capture->Spans.size(), Profiler::TraceCapacity);
+    CHECK_EQ(capture->Dropped, uint64_t{10});
+    CHECK_EQ(capture->Spans.front().StartNs, int64_t{10});
+    CHECK_EQ(capture->Spans.back().StartNs, static_cast<int64_t>(total - 1));
+}
+
+TEST_CASE("Profiler: trace JSON uses complete events relative to the first span")
+{
+    CS2Kit::Core::TraceCapture capture;
+    capture.Names = {"GameFrame", "event \"quoted\""};
+    capture.Spans = {{5'000'000, 1'500, 1}, {5'002'250, 250, 2}};
+    capture.Frames = 1;
+
+    const std::string json = capture.ToChromeJson();
+    CHECK_EQ(json, std::string(R"({"traceEvents":[)"
+                               R"({"name":"GameFrame","cat":"cs2kit","ph":"X","ts":0.000,"dur":1.500,"pid":1,"tid":1},)"
+                               R"({"name":"event \"quoted\"","cat":"cs2kit","ph":"X","ts":2.250,"dur":0.250,"pid":1,"tid":1})"
+                               R"(],"displayTimeUnit":"ms","otherData":{"frames":1,"dropped":0}})"));
+}
@@ -0,0 +1,199 @@
+#include "MicroTest.hpp"
+
+#include <CS2Kit/Core/Scheduler.hpp>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using CS2Kit::Core::Scheduler;
+
+TEST_CASE("Scheduler: NextTick fires once on the next frame")
+{
+    Scheduler sched;
+    int fired = 0;
+    sched.NextTick([&] { ++fired; });
+
+    sched.OnGameFrame();
+    CHECK_EQ(fired, 1);
+    sched.OnGameFrame();
+    CHECK_EQ(fired, 1);  // one-shot: erased after firing
+}
+
+TEST_CASE("Scheduler: EveryFrame refires until cancelled")
+{
+    Scheduler sched;
+    int fired = 0;
+    uint64_t id = sched.EveryFrame([&] { ++fired; });
+
+    sched.OnGameFrame();
+    sched.OnGameFrame();
+    CHECK_EQ(fired, 2);
+
+    sched.Cancel(id);
+    sched.OnGameFrame();
+    CHECK_EQ(fired, 2);
+}
+
+TEST_CASE("Scheduler: timers added by a callback wait for the next frame")
+{
+    Scheduler sched;
+    int inner = 0;
+    int lane = 0;
+    sched.NextTick([&] {
+        sched.NextTick([&] { ++inner; });
+        sched.EveryFrame([&] { ++lane; });
+    });
+
+    sched.OnGameFrame();
+    CHECK_EQ(inner, 0);
+    CHECK_EQ(lane, 0);
+
+    sched.OnGameFrame();
+    CHECK_EQ(inner, 1);
+    CHECK_EQ(lane, 1);
+}
+
+TEST_CASE("Scheduler: cancelling a later timer from an earlier callback skips it")
+{
+    Scheduler sched;
+    int second = 0;
+    uint64_t secondId = 0;
+    sched.NextTick([&] { sched.Cancel(secondId); });
+    secondId = sched.NextTick([&] { ++second; });
+
+    sched.OnGameFrame();
+    CHECK_EQ(second, 0);
+}
+
+TEST_CASE("Scheduler: a callback may cancel itself while running")
+{
+    Scheduler sched;
+    int fired = 0;
+    uint64_t id = 0;
+    id = sched.EveryFrame([&] {
+        ++fired;
+        sched.Cancel(id);
+    });
+
+    sched.OnGameFrame();
+    sched.OnGameFrame();
+    CHECK_EQ(fired, 1);
+}
+
+TEST_CASE("Scheduler: Delay waits for its deadline; due timers fire in deadline order")
+{
+    Scheduler sched;
+    std::vector<int> order;
+    sched.Delay(2, [&] { order.push_back(2); });
+    sched.Delay(1, [&] { order.push_back(1); });
+    sched.Delay(60000, [&] { order.push_back(0); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    sched.OnGameFrame();
+    CHECK_EQ(order.size(), 2u);
+    CHECK(order == (std::vector<int>{1, 2}));
+}
+
+TEST_CASE("Scheduler: Repeat re-arms after each fire")
+{
+    Scheduler sched;
+    int fired = 0;
+    sched.Repeat(1, [&] { ++fired; });
+
+    sched.OnGameFrame();
+    CHECK_EQ(fired, 0);  // not due yet
+    for (int i = 0; i < 3; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        sched.OnGameFrame();
+    }
+    CHECK_EQ(fired, 3);
+}
+
+TEST_CASE("Scheduler: mass cancel compacts and leaves survivors intact")
+{
+    Scheduler sched;
+    std::vector<uint64_t> ids;
+    for (int i = 0; i < 500; ++i)
+        ids.push_back(sched.Delay(60000, [] {}));
+    int fired = 0;
+    sched.NextTick([&] { ++fired; });
+    for (uint64_t id : ids)
+        sched.Cancel(id);
+
+    sched.OnGameFrame();
+    CHECK_EQ(fired, 1);
+}
+
+TEST_CASE("Scheduler: CancelAll from inside a callback stops the frame cleanly")
+{
+    Scheduler sched;
+    int after = 0;
+    sched.EveryFrame([&] { sched.CancelAll(); });
+    sched.EveryFrame([&] { ++after; });
+
+    sched.OnGameFrame();
+    sched.OnGameFrame();
+    CHECK_EQ(after, 0);
+}
+
+TEST_CASE("Scheduler: Defer drains in priority order and carries leftovers over")
+{
+    Scheduler sched;
+    sched.SetDeferBudgetUs(0);  // non-positive budget: exactly one item per frame
+    std::vector<int> order;
+    sched.Defer(CS2Kit::Core::DeferPriority::Low, [&] { order.push_back(3); });
+    sched.Defer(CS2Kit::Core::DeferPriority::Normal, [&] { order.push_back(2); });
+    sched.Defer(CS2Kit::Core::DeferPriority::High, [&] { order.push_back(1); });
+    CHECK_EQ(sched.GetDeferStats().Queued, 3u);
+
+    sched.OnGameFrame();
+    CHECK(order == (std::vector<int>{1}));
+    sched.OnGameFrame();
+    sched.OnGameFrame();
+    CHECK(order == (std::vector<int>{1, 2, 3}));
+    CHECK_EQ(sched.GetDeferStats().Queued, 0u);
+    CHECK_EQ(sched.GetDeferStats().Executed, 3u);
+}
+
+TEST_CASE("Scheduler: a generous Defer budget drains everything in one frame")
+{
+    Scheduler sched;
+    sched.SetDeferBudgetUs(1'000'000);
+    int ran = 0;
+    for (int i = 0; i < 100; ++i)
+        sched.Defer(CS2Kit::Core::DeferPriority::Normal, [&] { ++ran; });
+
+    sched.OnGameFrame();
+    CHECK_EQ(ran, 100);
+    CHECK_EQ(sched.GetDeferStats().Overruns, 0u);
+}
+
+TEST_CASE("Scheduler: Low priority is not starved by a steady High stream")
+{
+    Scheduler sched;
+    sched.SetDeferBudgetUs(0);
+    bool lowRan = false;
+    sched.Defer(CS2Kit::Core::DeferPriority::Low, [&] { lowRan = true; });
+
+    uint32_t frames = 0;
+    while (!lowRan && frames < 4 * Scheduler::MaxDeferWaitFrames)
+    {
+        sched.Defer(CS2Kit::Core::DeferPriority::High, [] {});
+        sched.OnGameFrame();
+        ++frames;
+    }
+    CHECK(lowRan);
+    CHECK(frames <= Scheduler::MaxDeferWaitFrames + 1);
+}
+
+TEST_CASE("Scheduler: CancelAll drops deferred work")
+{
+    Scheduler sched;
+    int ran = 0;
+    sched.Defer(CS2Kit::Core::DeferPriority::High, [&] { ++ran; });
+    sched.CancelAll();
+    sched.OnGameFrame();
+    CHECK_EQ(ran, 0);
+    CHECK_EQ(sched.GetDeferStats().Queued, 0u);
+}
@@ -0,0 +1,160 @@
+#include "MicroTest.hpp"
+
+#include <CS2Kit/Core/Registry.hpp>
+#include <CS2Kit/Sdk/SchemaField.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+using CS2Kit::Sdk::SchemaField;
+using CS2Kit::Sdk::SchemaFieldDecl;
+
+namespace
+{
+struct Sample
+{
+    uint8_t Mode;
+    int32_t Health;
+    uint64_t Buttons;
+};
+
+// Stand-in schema: the test binary has no SchemaService, so it supplies the resolver the
+// templates call into and counts the lookups that reach it.
+int g_lookups = 0;
+int g_lastExpectedSize = 0;
+bool g_schemaReady = true;
+}  // namespace
+
+namespace CS2Kit::Sdk
+{
+int ResolveSchemaOffset(const char* className, const char* fieldName, int expectedSize)
+{
+    ++g_lookups;
+    g_lastExpectedSize = expectedSize;
+    if (!g_schemaReady || std::strcmp(className, "Sample") != 0)
+        return -1;
+    if (std::strcmp(fieldName, "Health") == 0)
+        return offsetof(Sample, Health);
+    if (std::strcmp(fieldName, "Buttons") == 0)
+        return offsetof(Sample, Buttons);
+    if (std::strcmp(fieldName, "Mode") == 0)
+        return offsetof(Sample, Mode);
+    return -1;
+}
+}  // namespace CS2Kit::Sdk
+
+TEST_CASE("SchemaField: reads and writes at the resolved offset")
+{
+    using Health = SchemaField<"Sample", "Health", int32_t>;
+
+    Sample s{};
+    s.Health = 100;
+    CHECK_EQ(Health::Get(&s), 100);
+    Health::Set(&s, 42);
+    CHECK_EQ(s.Health, 42);
+    CHECK_EQ(Health::Offset(), static_cast<int>(offsetof(Sample, Health)));
+}
+
+TEST_CASE("SchemaField: resolves once and validates against sizeof(T)")
+{
+    using Buttons = SchemaField<"Sample", "Buttons", uint64_t>;
+
+    Sample s{};
+    s.Buttons = 7;
+    const int before = g_lookups;
+    for (int i = 0; i < 10; ++i)
+        CHECK_EQ(Buttons::Get(&s), uint64_t{7});
+    CHECK_EQ(g_lookups - before, 1);
+    CHECK_EQ(g_lastExpectedSize, static_cast<int>(sizeof(uint64_t)));
+}
+
+TEST_CASE("SchemaField: null base and unknown fields fall back")
+{
+    using Missing = SchemaField<"Sample", "NoSuchField", int32_t>;
+    using Health = SchemaField<"Sample", "Health", int32_t>;
+
+    Sample s{};
+    CHECK_EQ(Missing::Get(&s, -5), -5);
+    CHECK(Missing::Ptr(&s) == nullptr);
+    Missing::Set(&s, 1);  // no-op
+    CHECK_EQ(Health::Get(nullptr, -1), -1);
+}
+
+TEST_CASE("SchemaField: a failed lookup is retried, not cached")
+{
+    using Mode = SchemaField<"Sample", "Mode", uint8_t>;
+
+    Sample s{};
+    s.Mode = 3;
+    g_schemaReady = false;
+    CHECK_EQ(Mode::Offset(), -1);
+    CHECK_EQ(Mode::Offset(), -1);
+    g_schemaReady = true;
+    CHECK_EQ(Mode::Get(&s), uint8_t{3});
+
+    const int before = g_lookups;
+    CHECK_EQ(Mode::Get(&s), uint8_t{3});
+    CHECK_EQ(g_lookups, before);
+}
+
+TEST_CASE("SchemaField: ExpectedSize 0 skips the size check")
+{
+    using Embedded = SchemaField<"Sample", "Buttons", std::byte, 0>;
+
+    Sample s{};
+    CHECK(Embedded::Ptr(&s) == reinterpret_cast<std::byte*>(&s.Buttons));
+    CHECK_EQ(g_lastExpectedSize, 0);
+}
+
+TEST_CASE("FixedString: keeps the literal's text and length")
+{
+    constexpr CS2Kit::Utils::FixedString name("CBaseEntity");
+    static_assert(name.Size() == 11);
+    CHECK_EQ(std::string(name.View()), std::string("CBaseEntity"));
+    CHECK_EQ(std::string(name.CStr()), std::string("CBaseEntity"));
+}
+
+TEST_CASE("SchemaField: instantiations register for the load-time prewarm")
+{
+    using Prewarmed = SchemaField<"Sample", "Prewarmed", int32_t>;
+
+    const SchemaFieldDecl* found = nullptr;
+    for (const auto& decl : CS2Kit::Core::Registry<SchemaFieldDecl>::Items())
+        if (std::string(decl.ClassName) == "Sample" && std::string(decl.FieldName) == "Prewarmed")
+            found = &decl;
+    CHECK(found != nullptr);
+    if (!found)
+        return;
+    CHECK_EQ(found->ExpectedSize, static_cast<int>(sizeof(int32_t)));
+
+    // What SchemaService::Prewarm does: fill the slot, so first use never reaches the resolver.
+    *found->Slot = static_cast<int>(offsetof(Sample, Health));
+    const int before = g_lookups;
+    Sample s{};
+    s.Health = 9;
+    CHECK_EQ(Prewarmed::Get(&s), 9);
+    CHECK_EQ(g_lookups, before);
+}
+
+TEST_CASE("SchemaField: a field the prewarm marked missing is not looked up again")
+{
+    using Renamed = SchemaField<"Sample", "Renamed", int32_t>;
+
+    const SchemaFieldDecl* found = nullptr;
+    for (const auto& decl : CS2Kit::Core::Registry<SchemaFieldDecl>::Items())
+        if (std::string(decl.ClassName) == "Sample" && std::string(decl.FieldName) == "Renamed")
+            found = &decl;
+    CHECK(found != nullptr);
+    if (!found)
+        return;
+
+    // What SchemaService::Prewarm writes when the readable schema lacks the field.
+    *found->Slot = -1;
+    const int before = g_lookups;
+    Sample s{};
+    for (int i = 0; i < 10; ++i)
+        CHECK_EQ(Renamed::Get(&s, 7), 7);
+    CHECK(Renamed::Ptr(&s) == nullptr);
+    CHECK_EQ(g_lookups, before);
+}
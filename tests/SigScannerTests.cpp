@@ -0,0 +1,140 @@
+#include "MicroTest.hpp"
+
+#include "Sdk/SigScanner.hpp"
+
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+using CS2Kit::Sdk::FindPatternInImage;
+using CS2Kit::Sdk::FindPatternsInImage;
+using CS2Kit::Sdk::ScanKernel;
+using CS2Kit::Sdk::ScanResult;
+
+namespace
+{
+constexpr ScanKernel Kernels[] = {ScanKernel::Auto, ScanKernel::Sse2, ScanKernel::Avx2};
+
+// Hex pattern for image[at, at + length), with each byte wildcarded at probability 1/wildcardOdds.
+std::string PatternAt(const std::vector<uint8_t>& image, size_t at, size_t length, std::mt19937& rng,
+                      uint32_t wildcardOdds)
+{
+    std::string pattern;
+    for (size_t j = 0; j < length; ++j)
+    {
+        char hex[4];
+        std::snprintf(hex, sizeof(hex), "%02X", image[at + j]);
+        if (!pattern.empty())
+            pattern += ' ';
+        pattern += rng() % wildcardOdds == 0 ? "?" : hex;
+    }
+    return pattern;
+}
+
+bool Same(const ScanResult& a, const ScanResult& b)
+{
+    return a.Address == b.Address && a.Unique == b.Unique;
+}
+}  // namespace
+
+TEST_CASE("SigScanner: vector kernels agree with the scalar scan")
+{
+    std::mt19937 rng(99);
+    // A small alphabet makes partial and repeated matches common, so every kernel has to
+    // reject near-misses and report ambiguity exactly like the scalar scan.
+    for (int round = 0; round < 300; ++round)
+    {
+        const size_t size = 1 + rng() % 300;
+        std::vector<uint8_t> image(size);
+        const uint32_t alphabet = round % 2 == 0 ? 4 : 256;
+        for (auto& byte : image)
+            byte = static_cast<uint8_t>(0x40 + rng() % alphabet);
+
+        const size_t length = 1 + rng() % 12;
+        if (length > size)
+            continue;
+        // Patterns taken from the image, often from the last positions the vector loops hand to the tail.
+        const size_t at = round % 3 == 0 ? size - length : rng() % (size - length + 1);
+        const std::string pattern = PatternAt(image, at, length, rng, 3);
+
+        const auto expected = FindPatternInImage(image.data(), size, pattern, ScanKernel::Scalar);
+        CHECK(expected.Address != nullptr);
+        for (ScanKernel kernel : Kernels)
+            CHECK(Same(FindPatternInImage(image.data(), size, pattern, kernel), expected));
+    }
+}
+
+TEST_CASE("SigScanner: unique, ambiguous and missing patterns")
+{
+    std::vector<uint8_t> image(1000, 0x90);
+    const uint8_t prologue[] = {0x48, 0x89, 0x5C, 0x24, 0x08, 0x57};
+    for (size_t j = 0; j < sizeof(prologue); ++j)
+        image[700 + j] = prologue[j];
+
+    for (ScanKernel kernel : {ScanKernel::Scalar, ScanKernel::Sse2, ScanKernel::Avx2})
+    {
+        const auto unique = FindPatternInImage(image.data(), image.size(), "48 89 ? 24 08 57", kernel);
+        CHECK(unique.Address == image.data() + 700);
+        CHECK(unique.Unique);
+
+        const auto missing = FindPatternInImage(image.data(), image.size(), "48 89 5C 24 09", kernel);
+        CHECK(missing.Address == nullptr);
+
+        const auto ambiguous = FindPatternInImage(image.data(), image.size(), "90 90 ? 90", kernel);
+        CHECK(ambiguous.Address == image.data());
+        CHECK(!ambiguous.Unique);
+
+        // The last byte of the image is a candidate too.
+        image.back() = 0xCC;
+        const auto last = FindPatternInImage(image.data(), image.size(), "90 CC", kernel);
+        CHECK(last.Address == image.data() + image.size() - 2);
+        CHECK(last.Unique);
+        image.back() = 0x90;
+
+        // Nothing to search for: every offset matches.
+        const auto wildcards = FindPatternInImage(image.data(), image.size(), "? ?", kernel);
+        CHECK(wildcards.Address == image.data());
+        CHECK(!wildcards.Unique);
+
+        CHECK(FindPatternInImage(image.data(), 3, "90 90 90 90", kernel).Address == nullptr);
+        CHECK(FindPatternInImage(image.data(), image.size(), "", kernel).Address == nullptr);
+    }
+    CHECK(CS2Kit::Sdk::ScanKernelSupported(ScanKernel::Scalar));
+}
+
+TEST_CASE("SigScanner: one multi-pattern walk matches a scan per pattern")
+{
+    std::mt19937 rng(7);
+    for (int round = 0; round < 100; ++round)
+    {
+        const size_t size = 64 + rng() % 2000;
+        std::vector<uint8_t> image(size);
+        const uint32_t alphabet = round % 2 == 0 ? 6 : 256;
+        for (auto& byte : image)
+            byte = static_cast<uint8_t>(0xE0 + rng() % alphabet);
+
+        // Present, ambiguous (small alphabet), missing, all-wildcard and empty patterns, several
+        // sharing an anchor byte.
+        std::vector<std::string> patterns;
+        for (int i = 0; i < 24; ++i)
+        {
+            const size_t length = 1 + rng() % 10;
+            std::string pattern = PatternAt(image, rng() % (size - length + 1), length, rng, 4);
+            if (i % 5 == 0)
+                pattern += " 01";  // never in the small-alphabet images, rare in the others
+            patterns.push_back(std::move(pattern));
+        }
+        patterns.push_back("? ? ?");
+        patterns.push_back("");
+
+        for (ScanKernel kernel : {ScanKernel::Scalar, ScanKernel::Sse2, ScanKernel::Avx2, ScanKernel::Auto})
+        {
+            const auto results = FindPatternsInImage(image.data(), size, patterns, kernel);
+            CHECK_EQ(results.size(), patterns.size());
+            for (size_t i = 0; i < patterns.size() && i < results.size(); ++i)
+                CHECK(Same(results[i], FindPatternInImage(image.data(), size, patterns[i], ScanKernel::Scalar)));
+        }
+    }
+    CHECK(FindPatternsInImage(nullptr, 0, {}).empty());
+}
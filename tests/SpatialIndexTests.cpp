@@ -0,0 +1,164 @@
+#include "MicroTest.hpp"
+
+#include <CS2Kit/Sdk/SpatialIndex.hpp>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using CS2Kit::Sdk::SpatialHit;
+using CS2Kit::Sdk::SpatialIndex;
+using CS2Kit::Sdk::Vec3;
+
+namespace
+{
+std::vector<int> Ids(std::vector<SpatialHit> hits)
+{
+    std::vector<int> ids;
+    for (const auto& hit : hits)
+        ids.push_back(hit.Id);
+    std::ranges::sort(ids);
+    return ids;
+}
+
+float DistanceSq(const Vec3& a, const Vec3& b)
+{
+    const float dx = a.x - b.x;
+    const float dy = a.y - b.y;
+    const float dz = a.z - b.z;
+    return dx * dx + dy * dy + dz * dz;
+}
+}  // namespace
+
+TEST_CASE("SpatialIndex: radius, box and nearest match a brute-force scan")
+{
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> coord(-4000.0f, 4000.0f);
+    std::uniform_real_distribution<float> height(-200.0f, 600.0f);
+
+    SpatialIndex index(256.0f);
+    std::vector<Vec3> points(300);
+    for (int id = 0; id < 300; ++id)
+    {
+        points[id] = {coord(rng), coord(rng), height(rng)};
+        index.Upsert(id, points[id]);
+    }
+    CHECK_EQ(index.Size(), size_t{300});
+
+    for (int q = 0; q < 20; ++q)
+    {
+        const Vec3 center{coord(rng), coord(rng), height(rng)};
+        const float radius = q < 10 ? 300.0f : 2500.0f;  // small queries visit cells, large ones scan
+
+        std::vector<int> expected;
+        for (int id = 0; id < 300; ++id)
+            if (DistanceSq(points[id], center) <= radius * radius)
+                expected.push_back(id);
+        std::vector<SpatialHit> hits;
+        index.QueryRadius(center, radius, hits);
+        CHECK(Ids(hits) == expected);
+
+        const Vec3 lo{center.x - radius, center.y - radius * 0.5f, -100.0f};
+        const Vec3 hi{center.x + radius, center.y + radius * 0.5f, 300.0f};
+        expected.clear();
+        for (int id = 0; id < 300; ++id)
+        {
+            const Vec3& p = points[id];
+            if (p.x >= lo.x && p.x <= hi.x && p.y >= lo.y && p.y <= hi.y && p.z >= lo.z && p.z <= hi.z)
+                expected.push_back(id);
+        }
+        hits.clear();
+        index.QueryBox(lo, hi, hits);
+        CHECK(Ids(hits) == expected);
+
+        std::vector<int> byDistance(300);
+        for (int id = 0; id < 300; ++id)
+            byDistance[id] = id;
+        std::ranges::sort(byDistance, [&](int a, int b) { return DistanceSq(points[a], center) < DistanceSq(points[b], center); });
+        hits.clear();
+        index.Nearest(center, 5, hits);
+        CHECK_EQ(hits.size(), size_t{5});
+        for (size_t i = 0; i < hits.size(); ++i)
+            CHECK_EQ(hits[i].Id, byDistance[i]);
+    }
+}
+
+TEST_CASE("SpatialIndex: moving and removing points keeps cells consistent")
+{
+    SpatialIndex index(100.0f);
+    index.Upsert(0, {10.0f, 10.0f, 0.0f});
+    index.Upsert(1, {20.0f, 20.0f, 0.0f});
+    index.Upsert(2, {950.0f, 950.0f, 0.0f});
+
+    index.Upsert(1, {25.0f, 20.0f, 0.0f});     // same cell
+    index.Upsert(0, {900.0f, 900.0f, 0.0f});   // new cell
+    index.Remove(1);                           // swaps 2 into the freed dense slot
+    index.Remove(7);
+
+    std::vector<SpatialHit> hits;
+    index.QueryRadius({925.0f, 925.0f, 0.0f}, 50.0f, hits);
+    CHECK(Ids(hits) == std::vector<int>({0, 2}));
+
+    hits.clear();
+    index.QueryRadius({10.0f, 10.0f, 0.0f}, 50.0f, hits);
+    CHECK(hits.empty());
+    CHECK(!index.Contains(1));
+    CHECK_EQ(index.Position(2).x, 950.0f);
+
+    index.Clear();
+    CHECK_EQ(index.Size(), size_t{0});
+    hits.clear();
+    index.Nearest({0.0f, 0.0f, 0.0f}, 3, hits);
+    CHECK(hits.empty());
+}
+
+TEST_CASE("SpatialIndex: Nearest honours its filter and maximum distance")
+{
+    SpatialIndex index(64.0f);
+    for (int id = 0; id < 10; ++id)
+        index.Upsert(id, {static_cast<float>(id) * 100.0f, 0.0f, 0.0f});
+
+    std::vector<SpatialHit> hits;
+    index.Nearest({0.0f, 0.0f, 0.0f}, 3, hits, [](int id) { return id % 2 == 1; });
+    CHECK(Ids(hits) == std::vector<int>({1, 3, 5}));
+    CHECK_EQ(hits.front().Id, 1);
+    CHECK_EQ(hits.front().DistanceSq, 10000.0f);
+
+    hits.clear();
+    index.Nearest({0.0f, 0.0f, 0.0f}, 5, hits, 250.0f);
+    CHECK(Ids(hits) == std::vector<int>({0, 1, 2}));
+
+    hits.clear();
+    index.Nearest({5000.0f, 5000.0f, 0.0f}, 1, hits);  // far outside the bounds
+    CHECK_EQ(hits.size(), size_t{1});
+    CHECK_EQ(hits.front().Id, 9);
+}
+
+TEST_CASE("SpatialIndex: a Nearest filter may query the same index")
+{
+    SpatialIndex index(64.0f);
+    for (int id = 0; id < 10; ++id)
+        index.Upsert(id, {static_cast<float>(id) * 100.0f, 0.0f, 0.0f});
+    index.Upsert(10, {110.0f, 0.0f, 0.0f});  // 1's close neighbour
+
+    // Keep points with another point within 50 units: the filter runs Nearest and QueryRadius itself.
+    std::vector<SpatialHit> hits;
+    index.Nearest({0.0f, 0.0f, 0.0f}, 2, hits, [&](int id) {
+        std::vector<SpatialHit> nearby;
+        index.Nearest(index.Position(id), 2, nearby);
+        std::vector<SpatialHit> within;
+        index.QueryRadius(index.Position(id), 50.0f, within);
+        return nearby.size() == 2 && nearby[1].DistanceSq <= 2500.0f && within.size() == 2;
+    });
+    CHECK(Ids(hits) == std::vector<int>({1, 10}));
+    CHECK_EQ(hits.front().Id, 1);
+
+    // Moving points across cells and back leaves nothing behind that changes later results.
+    for (int round = 0; round < 50; ++round)
+        for (int id = 0; id < 10; ++id)
+            index.Upsert(id, {static_cast<float>(id) * 100.0f + static_cast<float>(round) * 1000.0f, 0.0f, 0.0f});
+    for (int id = 0; id < 10; ++id)
+        index.Upsert(id, {static_cast<float>(id) * 100.0f, 0.0f, 0.0f});
+    std::vector<SpatialHit> box;
+    index.QueryBox({-10.0f, -10.0f, -10.0f}, {150.0f, 10.0f, 10.0f}, box);
+    CHECK(Ids(box) == std::vector<int>({0, 1, 10}));
+}
@@ -0,0 +1,209 @@
+#include "MicroTest.hpp"
+
+#include <CS2Kit/Core/Scheduler.hpp>
+#include <CS2Kit/Core/Task.hpp>
+#include <stdexcept>
+#include <string>
+
+using CS2Kit::Core::NextFrame;
+using CS2Kit::Core::Scheduler;
+using CS2Kit::Core::Sleep;
+using CS2Kit::Core::Task;
+using CS2Kit::Core::TaskHost;
+
+namespace
+{
+
+/** Flips a flag when destroyed, to observe frame teardown. */
+struct DtorProbe
+{
+    bool* Destroyed;
+    ~DtorProbe() { *Destroyed = true; }
+};
+
+Task<> CountFrames(Scheduler& sched, int& steps, int frames)
+{
+    for (int i = 0; i < frames; ++i)
+    {
+        co_await NextFrame(sched);
+        ++steps;
+    }
+}
+
+Task<int> Double(Scheduler& sched, int value)
+{
+    co_await NextFrame(sched);
+    co_return value * 2;
+}
+
+Task<int> Sum(Scheduler& sched)
+{
+    int a = co_await Double(sched, 3);
+    int b = co_await Double(sched, 4);
+    co_return a + b;
+}
+
+Task<> Collect(Scheduler& sched, int& out)
+{
+    out = co_await Sum(sched);
+}
+
+Task<int> Throws()
+{
+    throw std::runtime_error("boom");
+    co_return 0;
+}
+
+Task<> Catches(std::string& what)
+{
+    try
+    {
+        co_await Throws();
+    }
+    catch (const std::runtime_error& e)
+    {
+        what = e.what();
+    }
+}
+
+Task<> Waits(Scheduler& sched, int64_t delayMs, bool& destroyed, bool& resumed)
+{
+    DtorProbe probe{&destroyed};
+    co_await Sleep(sched, delayMs);
+    resumed = true;
+}
+
+Task<> CancelsItself(TaskHost& host, uint64_t& self, Scheduler& sched, bool& destroyed, bool& afterCancel)
+{
+    DtorProbe probe{&destroyed};
+    co_await NextFrame(sched);
+    host.Cancel(self);
+    afterCancel = !destroyed;  // still running: the frame must outlive this statement
+    co_await NextFrame(sched);
+    afterCancel = false;  // never resumed once cancelled
+}
+
+Task<> RecordFrame(const void*& where)
+{
+    int local = 0;
+    where = &local;
+    co_return;
+}
+
+}  // namespace
+
+TEST_CASE("Task: runs inline until its first suspension, then resumes on scheduler frames")
+{
+    Scheduler sched;
+    TaskHost host;
+    int steps = 0;
+
+    uint64_t id = host.Spawn(CountFrames(sched, steps, 3));
+    CHECK(id != 0);
+    CHECK_EQ(steps, 0);
+    CHECK_EQ(host.Count(), size_t{1});
+
+    sched.OnGameFrame();
+    CHECK_EQ(steps, 1);
+    sched.OnGameFrame();
+    sched.OnGameFrame();
+    CHECK_EQ(steps, 3);
+    CHECK(!host.Alive(id));
+    CHECK_EQ(host.Count(), size_t{0});
+}
+
+TEST_CASE("Task: a task that never suspends finishes inside Spawn")
+{
+    TaskHost host;
+    const void* where = nullptr;
+    CHECK_EQ(host.Spawn(RecordFrame(where)), uint64_t{0});
+    CHECK(where != nullptr);
+    CHECK_EQ(host.Count(), size_t{0});
+}
+
+TEST_CASE("Task: awaited children return values to their parent")
+{
+    Scheduler sched;
+    TaskHost host;
+    int out = 0;
+    host.Spawn(Collect(sched, out));
+
+    for (int i = 0; i < 4 && out == 0; ++i)
+        sched.OnGameFrame();
+    CHECK_EQ(out, 14);
+    CHECK_EQ(host.Count(), size_t{0});
+}
+
+TEST_CASE("Task: exceptions propagate to the awaiting parent")
+{
+    TaskHost host;
+    std::string what;
+    host.Spawn(Catches(what));
+    CHECK_EQ(what, std::string("boom"));
+}
+
+TEST_CASE("Task: Cancel destroys a suspended task and its late wake-up is dropped")
+{
+    Scheduler sched;
+    TaskHost host;
+    bool destroyed = false;
+    bool resumed = false;
+
+    uint64_t id = host.Spawn(Waits(sched, 0, destroyed, resumed));
+    CHECK(host.Alive(id));
+
+    host.Cancel(id);
+    CHECK(destroyed);
+    CHECK(!host.Alive(id));
+
+    // The scheduler still holds the wake-up token; firing it must not touch the freed frame.
+    sched.OnGameFrame();
+    CHECK(!resumed);
+}
+
+TEST_CASE("Task: CancelAll unwinds every suspended task")
+{
+    Scheduler sched;
+    bool destroyedA = false, destroyedB = false, resumed = false;
+    {
+        TaskHost host;
+        host.Spawn(Waits(sched, 1'000'000, destroyedA, resumed));
+        host.Spawn(Waits(sched, 1'000'000, destroyedB, resumed));
+        CHECK_EQ(host.Count(), size_t{2});
+
+        host.CancelAll();
+        CHECK(destroyedA);
+        CHECK(destroyedB);
+        CHECK_EQ(host.Count(), size_t{0});
+    }
+    CHECK(!resumed);
+}
+
+TEST_CASE("Task: a task cancelling itself is torn down after it suspends")
+{
+    Scheduler sched;
+    TaskHost host;
+    uint64_t self = 0;
+    bool destroyed = false;
+    bool afterCancel = false;
+
+    self = host.Spawn(CancelsItself(host, self, sched, destroyed, afterCancel));
+    sched.OnGameFrame();
+    CHECK(afterCancel);
+    CHECK(destroyed);
+    CHECK(!host.Alive(self));
+
+    sched.OnGameFrame();  // the pending NextFrame token finds the task gone
+    CHECK(afterCancel);
+}
+
+TEST_CASE("Task: finished frames are recycled for the next task of the same size")
+{
+    TaskHost host;
+    const void* first = nullptr;
+    const void* second = nullptr;
+    host.Spawn(RecordFrame(first));
+    host.Spawn(RecordFrame(second));
+    CHECK(first != nullptr);
+    CHECK_EQ(first, second);
+}
@@ -0,0 +1,181 @@
+#include "MicroTest.hpp"
+
+#include <CS2Kit/Core/MpscQueue.hpp>
+#include <CS2Kit/Core/ThreadPool.hpp>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using CS2Kit::Core::MpscNode;
+using CS2Kit::Core::MpscQueue;
+using CS2Kit::Core::ThreadPool;
+
+namespace
+{
+
+/** Pump @p pool like the game frame does until @p done holds or a generous deadline passes. */
+template <class Pred>
+bool PumpUntil(ThreadPool& pool, Pred done)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!done())
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+            return false;
+        pool.DispatchCompletions();
+        std::this_thread::yield();
+    }
+    return true;
+}
+
+struct Item : MpscNode
+{
+    int Producer = 0;
+    int Seq = 0;
+};
+
+}  // namespace
+
+TEST_CASE("MpscQueue: concurrent producers, per-producer FIFO order")
+{
+    constexpr int Producers = 4;
+    constexpr int PerProducer = 20000;
+    std::vector<Item> items(Producers * PerProducer);
+    MpscQueue<Item> queue;
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < Producers; ++p)
+        threads.emplace_back([&, p] {
+            for (int i = 0; i < PerProducer; ++i)
+            {
+                auto& item = items[p * PerProducer + i];
+                item.Producer = p;
+                item.Seq = i;
+                queue.Push(&item);
+            }
+        });
+
+    std::vector<int> next(Producers, 0);
+    int received = 0;
+    bool ordered = true;
+    while (received < Producers * PerProducer)
+    {
+        if (Item* item = queue.Pop())
+        {
+            ordered = ordered && item->Seq == next[item->Producer];
+            next[item->Producer] = item->Seq + 1;
+            ++received;
+        }
+    }
+    for (auto& t : threads)
+        t.join();
+
+    CHECK(ordered);
+    CHECK(queue.Pop() == nullptr);
+}
+
+TEST_CASE("ThreadPool: work runs off-thread, onDone on the dispatching thread with the result")
+{
+    ThreadPool pool;
+    pool.Start(2);
+    const auto gameThread = std::this_thread::get_id();
+
+    std::atomic<bool> workOffThread{false};
+    bool doneOnGameThread = false;
+    int result = 0;
+    pool.Run(
+        [&] {
+            workOffThread = std::this_thread::get_id() != gameThread;
+            return 21 * 2;
+        },
+        [&](int value) {
+            doneOnGameThread = std::this_thread::get_id() == gameThread;
+            result = value;
+        });
+
+    CHECK(PumpUntil(pool, [&] { return result != 0; }));
+    CHECK(workOffThread.load());
+    CHECK(doneOnGameThread);
+    CHECK_EQ(result, 42);
+    CHECK_EQ(pool.Completed(), uint64_t{1});
+}
+
+TEST_CASE("ThreadPool: fan-out from inside a job is stolen by idle workers")
+{
+    ThreadPool pool;
+    pool.Start(4);
+
+    constexpr int Children = 256;
+    std::atomic<int> ran{0};
+    int done = 0;
+    pool.Run([&] {
+        // Queued on this worker's own deque; the other three can only get them by stealing.
+        for (int i = 0; i < Children; ++i)
+            pool.Run([&] { ran.fetch_add(1); }, [&] { ++done; });
+    });
+
+    CHECK(PumpUntil(pool, [&] { return done == Children; }));
+    CHECK_EQ(ran.load(), Children);
+    CHECK_EQ(pool.Queued(), size_t{0});
+}
+
+TEST_CASE("ThreadPool: a throwing job skips onDone")
+{
+    ThreadPool pool;
+    pool.Start(1);
+    bool thrownDone = false;
+    bool laterDone = false;
+    pool.Run([]() -> int { throw std::runtime_error("boom"); }, [&](int) { thrownDone = true; });
+    pool.Run([] {}, [&] { laterDone = true; });
+
+    // A lone worker takes its newest job first, so wait for both completions, not just the later one.
+    CHECK(PumpUntil(pool, [&] { return pool.Completed() == 2; }));
+    CHECK(laterDone);
+    CHECK(!thrownDone);
+}
+
+TEST_CASE("ThreadPool: Stop joins workers and drops undispatched completions")
+{
+    ThreadPool pool;
+    pool.Start(2);
+    std::atomic<int> ran{0};
+    int done = 0;
+    for (int i = 0; i < 8; ++i)
+        pool.Run([&] { ran.fetch_add(1); }, [&] { ++done; });
+
+    while (ran.load() < 8)
+        std::this_thread::yield();
+    pool.Stop();
+
+    pool.DispatchCompletions();
+    CHECK_EQ(done, 0);
+
+    pool.Run([&] { ran.fetch_add(1); });  // ignored after Stop
+    CHECK_EQ(ran.load(), 8);
+    pool.Stop();  // idempotent
+}
+
+TEST_CASE("ThreadPool: Stop while pool work keeps queueing more")
+{
+    ThreadPool pool;
+    pool.Start(2);
+    std::atomic<int> ran{0};
+    // Each link queues the next from its worker, so Submit runs on workers while Stop joins them.
+    std::function<void()> link = [&] {
+        ran.fetch_add(1);
+        pool.Run(link);
+    };
+    pool.Run(link);
+    pool.Run(link);
+
+    while (ran.load() < 100)
+        std::this_thread::yield();
+    pool.Stop();
+
+    const int stoppedAt = ran.load();
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    CHECK_EQ(ran.load(), stoppedAt);
+}